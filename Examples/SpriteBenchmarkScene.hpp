@@ -0,0 +1,82 @@
+//
+//  SpriteBenchmarkScene.hpp
+//  SaplingEngine, Sprout Renderer
+//
+
+//  Draws an increasing number of sprites and logs the renderer's CPU
+//  frame cost at each count. Register it with
+//  engine.newScene<SpriteBenchmarkScene>("benchmark") and switch to it;
+//  the results are printed through Debug::log, so build with DEBUG.
+
+#pragma once
+
+#include "Core/Scene.hpp"
+#include "Core/AssetManager.hpp"
+#include "Renderer/Sprout.hpp"
+#include "Utility/Debug.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+class SpriteBenchmarkScene : public Scene
+{
+    public:
+        explicit SpriteBenchmarkScene(Engine& engine) : Scene(engine) {}
+
+        void init() override {}
+
+        void update() override
+        {
+            if (m_step >= SpriteCounts.size())
+            {
+                return;
+            }
+
+            auto& window = m_engine.getWindow();
+
+            // stats describe the previous frame, which drew SpriteCounts[m_step] sprites
+            const Sprout::FrameStats& stats = window.getFrameStats();
+            if (m_frame > WarmupFrames)
+            {
+                m_cpuMs += stats.cpu_frame_ms;
+                m_submitMs += stats.submit_ms;
+                m_uploadBytes += stats.upload_bytes;
+            }
+
+            if (m_frame == WarmupFrames + MeasuredFrames)
+            {
+                Debug::log("sprites " + std::to_string(SpriteCounts[m_step])
+                    + " cpu " + std::to_string(m_cpuMs / MeasuredFrames) + " ms"
+                    + " submit " + std::to_string(m_submitMs / MeasuredFrames) + " ms"
+                    + " upload " + std::to_string(m_uploadBytes / MeasuredFrames) + " bytes"
+                    + " dropped " + std::to_string(stats.dropped_draws)
+                    + " culled " + std::to_string(stats.culled_draws));
+                m_step++;
+                m_frame = 0;
+                m_cpuMs = m_submitMs = 0.0;
+                m_uploadBytes = 0;
+                return;
+            }
+
+            const auto texture = AssetManager::getTexture("debugCircle");
+            const int count = SpriteCounts[m_step];
+            for (int i = 0; i < count; i++)
+            {
+                const glm::vec2 position(static_cast<float>((i * 7) % 640), static_cast<float>((i * 13) % 360));
+                window.draw_sprite(texture, position, static_cast<float>(i) / static_cast<float>(count));
+            }
+            m_frame++;
+        }
+
+    private:
+        static constexpr std::array<int, 10> SpriteCounts = {100, 250, 500, 1000, 2000, 4000, 8000, 16000, 50000, 100000};
+        static constexpr size_t WarmupFrames = 10;
+        static constexpr size_t MeasuredFrames = 120;
+
+        size_t m_step = 0;
+        size_t m_frame = 0;
+        double m_cpuMs = 0.0;
+        double m_submitMs = 0.0;
+        size_t m_uploadBytes = 0;
+};
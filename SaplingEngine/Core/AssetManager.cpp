@@ -5,11 +5,14 @@
 
 #include "Core/AssetManager.hpp"
 #include "Core/AudioEngine.hpp"
+#include "Renderer/AtlasFormat.hpp"
 #include "Renderer/Font.hpp"
+#include "Renderer/Sprout.hpp"
 #include "Utility/Debug.hpp"
 
 #include "fmod_common.h"
 
+#include <cmath>
 #include <filesystem>
 #include <iostream>
 #include <string>
@@ -100,9 +103,50 @@ std::string AssetManager::getAssetsPath() {
     return "../../GameContent/Assets/"; // fallback path for development
 }
 
+bool AssetManager::loadBakedAtlas()
+{
+    std::string path = getAssetsPath() + Sprout::BAKED_ATLAS_FILE;
+    if (!Sprout::Window::getInstance()->getAtlas().loadBaked(path))
+    {
+        Debug::log("no baked atlas, textures are packed at load");
+        return false;
+    }
+    Debug::log("loaded baked atlas " + path);
+    return true;
+}
+
+// baked atlas names are relative to the assets path with forward slashes
+static bool findBakedTexture(const std::string& path, Sprout::TextureAtlas::BakedRegion& region)
+{
+    std::string name = std::filesystem::path(path).lexically_normal().generic_string();
+    return Sprout::Window::getInstance()->getAtlas().findBaked(name, region);
+}
+
+// baked textures have no pixels of their own, check what of them is in the page
+static bool isBakedOpaque(const glm::vec4& uvs, glm::i32 page)
+{
+    const Sprout::TextureAtlas& atlas = Sprout::Window::getInstance()->getAtlas();
+    const float size = static_cast<float>(atlas.getPageSize());
+    const int x = static_cast<int>(std::round(uvs.x * size));
+    const int y = static_cast<int>(std::round(uvs.y * size));
+    const int width = static_cast<int>(std::round(uvs.z * size)) - x;
+    const int height = static_cast<int>(std::round(uvs.w * size)) - y;
+    const unsigned char* pixels = atlas.getPagePixels(page) + (static_cast<size_t>(y) * atlas.getPageSize() + x) * 4;
+    return !Sprout::has_partial_alpha(pixels, atlas.getPageSize(), width, height);
+}
+
 void AssetManager::addTexture(const std::string& name, const std::string& path, const glm::i32 numFrames) {
     auto tex = std::make_shared<Sprout::Texture>();
     
+    Sprout::TextureAtlas::BakedRegion region;
+    if (findBakedTexture(path, region))
+    {
+        tex->loadFromAtlas(region.width, region.height, region.uvs, region.trim, region.page, numFrames);
+        tex->setOpaque(isBakedOpaque(region.uvs, region.page));
+        Instance->m_textures[name] = tex;
+        return;
+    }
+    
     if (!tex->loadFromFile(getAssetsPath() + path, numFrames)) 
     {        
         std::string fullPath = getAssetsPath() + path;
@@ -122,6 +166,39 @@ auto AssetManager::getTexture(const std::string& name) -> std::shared_ptr<Sprout
 
 void AssetManager::addTileSet(const std::string& name, const std::string& path, size_t w, size_t h)
 {
+    // baked tilesets are one region, each tile gets what trimming left of its slice, in the same order loadTileset uses
+    Sprout::TextureAtlas::BakedRegion region;
+    if (findBakedTexture(path, region))
+    {
+        Sprout::Texture whole;
+        whole.loadFromAtlas(region.width, region.height, region.uvs, region.trim, region.page);
+        
+        std::vector<std::shared_ptr<Sprout::Texture>> tileset;
+        size_t numTiles_x = region.width / w;
+        size_t numTiles_y = region.height / h;
+        
+        for (size_t y = 0; y < numTiles_y; y++)
+        {
+            for (size_t x = 0; x < numTiles_x; x++)
+            {
+                glm::vec4 rect = glm::vec4(0.0f);
+                glm::vec4 uvs = glm::vec4(0.0f);
+                whole.getPackedRegion(glm::vec4(x * w, y * h, w, h), rect, uvs);
+                
+                auto tile = std::make_shared<Sprout::Texture>();
+                tile->loadFromAtlas(w, h, uvs, rect, region.page);
+                tile->setOpaque(isBakedOpaque(uvs, region.page));
+                tileset.push_back(tile);
+            }
+        }
+        if (tileset.empty())
+        {
+            throw std::runtime_error("Error loading tileset file: " + path);
+        }
+        Instance->m_tilesets[name] = tileset;
+        return;
+    }
+    
     std::vector<std::shared_ptr<Sprout::Texture>> tileset = Sprout::Texture::loadTileset(getAssetsPath() + path, w, h);
     if (tileset.empty())
     {
@@ -165,9 +242,10 @@ auto AssetManager::getSound(const std::string &name) -> FMOD::Sound*
     return it->second;
 }
 
-void AssetManager::addFont(const std::string &name, const std::string &path, float size)
+void AssetManager::addFont(const std::string &name, const std::string &path, float size, bool sdf)
 {
     auto font = std::make_shared<Sprout::Font>();
+    font->sdf = sdf;
     if (!font->loadFromFile(getAssetsPath() + path, size))
     {
         throw std::runtime_error("Error loading font file: " + path);
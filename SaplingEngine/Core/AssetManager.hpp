@@ -52,6 +52,14 @@ public:
         * @return The assets path
     */
     static std::string getAssetsPath();
+    
+    /*
+        * Maps the atlas baked by AtlasBaker from the assets path, if there is one.
+        * Textures and tilesets found in it are then added without decoding or packing.
+        * Must be called before any texture is added.
+        * @return True if a baked atlas was loaded
+    */
+    static bool loadBakedAtlas();
     /*
         * Adds a texture to the asset manager
         * @param name The name of the texture
@@ -105,8 +113,9 @@ public:
         * @param name The name of the font
         * @param path The path to the font
         * @param size The size of the font
+        * @param sdf Whether the font is drawn from signed distance fields, which stay sharp at any size
     */
-    static void addFont(const std::string& name, const std::string& path, float size);
+    static void addFont(const std::string& name, const std::string& path, float size, bool sdf = false);
     
     /*
         * Gets the font with the given name
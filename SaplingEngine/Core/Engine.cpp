@@ -7,6 +7,7 @@
 #include "Core/Engine.hpp"
 #include "Core/AssetManager.hpp"
 #include "Core/SceneMessage.hpp"
+#include "Core/JobSystem.hpp"
 
 #include <cstddef>
 #include <memory>
@@ -17,10 +18,18 @@ Engine::Engine(size_t viewportWidth, size_t viewportHeight, const char* title)
 {
     m_scenes = sceneMap();
     AssetManager::getInstance();
+    AssetManager::loadBakedAtlas();
+    JobSystem::initialize();
 
     Debug::log("init completed");
 }
 
+Engine::~Engine()
+{
+    // headless runs return from run and tear the engine down, the workers have to be joined before exit
+    JobSystem::cleanUp();
+}
+
 void Engine::run()
 {
     m_window.SetUpdateFrameCallback([this](double dt) { this -> update(dt);});
@@ -28,6 +37,12 @@ void Engine::run()
     m_window.Run(); // nothing after this gets called
 }
 
+void Engine::run(int argc, char** argv)
+{
+    m_window.parseArguments(argc, argv);
+    run();
+}
+
 void Engine::update(double dt)
 {
     m_deltaTime = dt;
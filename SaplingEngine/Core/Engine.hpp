@@ -35,12 +35,23 @@ class Engine {
 public:
 
     Engine(size_t viewportWidth, size_t viewportHeight, const char* title);
-    ~Engine() = default;
+    ~Engine();
     
     /**
-     * The main loop of the game. Nothing after this function gets called.
+     * The main loop of the game. Windowed nothing after this function gets called,
+     * headless (SAPLING_HEADLESS) it returns once the frame limit is reached and the engine can be destroyed.
+     * Headless runs without a frame limit log an error and return straight away.
      */
     void run();
+
+    /**
+     * Runs the game with the options given on the command line, see Sprout::Window::parseArguments.
+     * Windowed nothing after this function gets called, headless it returns once the --frames limit is reached.
+     *
+     * @param argc  The argument count from main
+     * @param argv  The arguments from main
+     */
+    void run(int argc, char** argv);
     
     /**
      * The main update function of the game, called each frame. Must be set as callback to the window.
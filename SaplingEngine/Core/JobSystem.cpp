@@ -0,0 +1,161 @@
+//
+//  JobSystem.cpp
+//  SaplingEngine
+//
+
+#include "Core/JobSystem.hpp"
+
+#include <algorithm>
+
+
+JobSystem* JobSystem::Instance = nullptr;
+
+namespace
+{
+    // set on worker threads and while the caller runs chunks, nested parallelFor calls run inline
+    thread_local bool insideJob = false;
+}
+
+JobSystem::~JobSystem()
+{
+    cleanUp();
+}
+
+void JobSystem::initialize(size_t workerCount)
+{
+    JobSystem* self = getInstance();
+    if (self->m_initialized)
+    {
+        return;
+    }
+
+    if (workerCount == 0)
+    {
+        const size_t hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    self->m_stopping = false;
+    self->m_initialized = true;
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        self->m_workers.emplace_back([self] { self->workerLoop(); });
+    }
+}
+
+void JobSystem::cleanUp()
+{
+    JobSystem* self = Instance;
+    if (!self)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(self->m_mutex);
+        self->m_stopping = true;
+    }
+    self->m_wake.notify_all();
+    for (auto& worker : self->m_workers)
+    {
+        worker.join();
+    }
+    self->m_workers.clear();
+    self->m_initialized = false;
+}
+
+auto JobSystem::getThreadCount() -> size_t
+{
+    return getInstance()->m_workers.size() + 1;
+}
+
+void JobSystem::parallelFor(size_t count, size_t grainSize, const RangeJob& job)
+{
+    grainSize = std::max<size_t>(grainSize, 1);
+    const size_t chunks = chunkCount(count, grainSize);
+    if (chunks == 0)
+    {
+        return;
+    }
+
+    JobSystem* self = getInstance();
+    if (!self->m_initialized)
+    {
+        initialize();
+    }
+
+    if (chunks == 1 || self->m_workers.empty() || insideJob)
+    {
+        for (size_t chunk = 0; chunk < chunks; chunk++)
+        {
+            job(chunk, chunk * grainSize, std::min(count, (chunk + 1) * grainSize));
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(self->m_submitMutex);
+    {
+        std::lock_guard<std::mutex> lock(self->m_mutex);
+        self->m_job = &job;
+        self->m_count = count;
+        self->m_grainSize = grainSize;
+        self->m_chunks = chunks;
+        self->m_nextChunk = 0;
+        self->m_doneChunks = 0;
+        self->m_generation++;
+    }
+    self->m_wake.notify_all();
+
+    insideJob = true;
+    self->runChunks(job, count, grainSize, chunks);
+    insideJob = false;
+
+    // the job lives on the caller's stack, wait until no worker can still touch it
+    std::unique_lock<std::mutex> lock(self->m_mutex);
+    self->m_finished.wait(lock, [self] { return self->m_doneChunks == self->m_chunks && self->m_busyWorkers == 0; });
+    self->m_job = nullptr;
+}
+
+void JobSystem::runChunks(const RangeJob& job, size_t count, size_t grainSize, size_t chunks)
+{
+    size_t done = 0;
+    for (size_t chunk = m_nextChunk++; chunk < chunks; chunk = m_nextChunk++)
+    {
+        job(chunk, chunk * grainSize, std::min(count, (chunk + 1) * grainSize));
+        done++;
+    }
+    if (done)
+    {
+        m_doneChunks += done;
+    }
+}
+
+void JobSystem::workerLoop()
+{
+    insideJob = true;
+    uint64_t seenGeneration = 0;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_wake.wait(lock, [&] { return m_stopping || (m_generation != seenGeneration && m_job); });
+        if (m_stopping)
+        {
+            return;
+        }
+        seenGeneration = m_generation;
+
+        const RangeJob& job = *m_job;
+        const size_t count = m_count;
+        const size_t grainSize = m_grainSize;
+        const size_t chunks = m_chunks;
+        m_busyWorkers++;
+
+        lock.unlock();
+        runChunks(job, count, grainSize, chunks);
+        lock.lock();
+
+        m_busyWorkers--;
+        m_finished.notify_all();
+    }
+}
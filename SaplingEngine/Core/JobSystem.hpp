@@ -0,0 +1,104 @@
+//
+//  JobSystem.hpp
+//  SaplingEngine
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/*
+    * A fixed pool of worker threads for splitting one loop across cores.
+    * parallelFor blocks until every chunk is done and the calling thread works on chunks too,
+    * so it can be dropped into a system without restructuring the frame.
+    * Chunks run in no particular order; callers that need deterministic results write
+    * into per-chunk storage and merge it in chunk order afterwards.
+*/
+class JobSystem
+{
+    public:
+        using RangeJob = std::function<void(size_t chunk, size_t begin, size_t end)>;
+
+        static JobSystem* getInstance()
+        {
+            if (!Instance)
+            {
+                Instance = new JobSystem();
+            }
+            return Instance;
+        }
+
+        /*
+            * Starts the worker threads, one less than the hardware threads so the main thread keeps its core.
+            * Called lazily by the first parallelFor.
+            * @param workerCount The number of workers, 0 picks from the hardware
+        */
+        static void initialize(size_t workerCount = 0);
+
+        /*
+            * Joins the worker threads, later parallelFor calls run on the calling thread.
+        */
+        static void cleanUp();
+
+        /*
+            * Splits [0, count) into chunks of grainSize and runs job(chunk, begin, end) for each, across the workers.
+            * Runs inline when there is a single chunk, no workers, or when called from inside another job.
+            * @param count The number of items
+            * @param grainSize The number of items per chunk
+            * @param job The function to run for every chunk
+        */
+        static void parallelFor(size_t count, size_t grainSize, const RangeJob& job);
+
+        /*
+            * Gets the number of chunks parallelFor will split count items into
+            * @param count The number of items
+            * @param grainSize The number of items per chunk
+            * @return The number of chunks
+        */
+        static auto chunkCount(size_t count, size_t grainSize) -> size_t
+        {
+            grainSize = grainSize ? grainSize : 1;
+            return (count + grainSize - 1) / grainSize;
+        }
+
+        /*
+            * Gets the number of threads working on a parallelFor, including the caller
+            * @return The thread count
+        */
+        static auto getThreadCount() -> size_t;
+
+    private:
+        static JobSystem* Instance;
+
+        std::vector<std::thread> m_workers;
+        std::mutex m_submitMutex; // one parallelFor at a time
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_finished;
+        bool m_initialized = false;
+        bool m_stopping = false;
+        uint64_t m_generation = 0;
+
+        // the batch being worked on, guarded by m_mutex except for the atomics
+        const RangeJob* m_job = nullptr;
+        size_t m_count = 0;
+        size_t m_grainSize = 1;
+        size_t m_chunks = 0;
+        size_t m_busyWorkers = 0;
+        std::atomic<size_t> m_nextChunk = 0;
+        std::atomic<size_t> m_doneChunks = 0;
+
+        JobSystem() = default;
+        ~JobSystem();
+
+        void workerLoop();
+        void runChunks(const RangeJob& job, size_t count, size_t grainSize, size_t chunks);
+};
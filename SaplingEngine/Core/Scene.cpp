@@ -5,11 +5,14 @@
 
 #include "Core/Scene.hpp"
 #include "Core/AudioEngine.hpp"
+#include "Core/JobSystem.hpp"
 #include "ECS/Component.hpp"
 #include "Renderer/Sprout.hpp"
 #include "Core/SceneMessage.hpp"
 #include "Utility/Debug.hpp"
 
+#include <algorithm>
+
 
 Scene::Scene(Engine& engine) : m_engine(engine)
 {
@@ -35,6 +38,10 @@ void Scene::enable()
 {
     // set the window's event callback to our input system
     m_engine.getWindow().SetEventCallback([](const sapp_event* e) { Input::update(e); });
+    // the level may have changed while the scene was disabled, rebake static colliders on the next physics step
+    // and static sprites on the next render
+    m_physicsWorld.markStaticDirty();
+    m_staticSprites.markDirty();
     Debug::log("enabling scene");
     onSceneEnabled();
 }
@@ -45,124 +52,229 @@ void Scene::disable()
     onSceneDisabled();
 }
 
-void Scene::sRender(EntityList& entities)
+void Scene::sPhysics()
 {
-    glm::f32 numEntities = entities.size();
-    glm::f32 currentEnt = 0;
+    m_physicsWorld.step(*m_entityManager, m_engine.deltaTime());
+}
 
-    float dt = m_engine.deltaTime();
-    for (const auto& e : entities)
+void Scene::sRender(EntityList& entities)
+{
+    Sprout::Window& window = m_engine.getWindow();
+    const size_t chunks = JobSystem::chunkCount(entities.size(), RenderGrain);
+    m_sharedSpriteDraws.resize(chunks);
+    
+    // every chunk of entities records into its own draw stream, merged in entity order so the frame is the same either way
+    window.beginDrawStreams(chunks);
+    const JobSystem::RangeJob job = [&](size_t chunk, size_t begin, size_t end)
     {
-        if (e->hasComponent<Comp::GridTransform>() && e->hasComponent<Comp::Transform>())
+        window.setDrawStream(static_cast<int>(chunk));
+        m_sharedSpriteDraws[chunk].clear();
+        for (size_t i = begin; i < end; i++)
         {
-            auto& gridTransform = e->getComponent<Comp::GridTransform>();
-            auto& transform = e->getComponent<Comp::Transform>();
-            transform.position = gridTransform.getWorldPosition();
+            renderEntity(entities[i], static_cast<glm::f32>(i), static_cast<glm::f32>(entities.size()), m_sharedSpriteDraws[chunk]);
         }
-        
-        if (e->hasComponentEnabled<Comp::Sprite>())
+        window.setDrawStream(-1);
+    };
+    if (m_multithreadedRender)
+    {
+        JobSystem::parallelFor(entities.size(), RenderGrain, job);
+    }
+    else
+    {
+        for (size_t chunk = 0; chunk < chunks; chunk++)
         {
-            
-            auto& cSprite = e->getComponent<Comp::Sprite>();
+            job(chunk, chunk * RenderGrain, std::min(entities.size(), (chunk + 1) * RenderGrain));
+        }
+    }
+    window.endDrawStreams();
+    
+    // static and retained sprites go through caches shared by the whole scene, finish them here in entity order
+    for (const auto& draws : m_sharedSpriteDraws)
+    {
+        for (const SharedSpriteDraw& draw : draws)
+        {
+            renderSharedSprite(draw);
+        }
+    }
+    
+    m_staticSprites.draw(window);
+    if (m_retainedBatch >= 0)
+    {
+        window.draw_retained_batch(m_retainedBatch);
+    }
+}
 
-            if (cSprite.type == Comp::Sprite::Type::Animated)
-            {
-                // update the animation frame based on delta time
-                cSprite.animationTime += dt;
-                if (cSprite.animationTime >= (1.0f / cSprite.animationSpeed))
-                {
-                    cSprite.currentFrame = (cSprite.currentFrame + 1) % cSprite.numFrames;
-                    cSprite.animationTime = 0.0f;
-                }
-            }
-            glm::f32 depth = 1 - (static_cast<glm::f32>(cSprite.layer) + currentEnt / numEntities) / static_cast<glm::f32>(Comp::Layer::Count);
-            glm::vec2 pos = glm::vec2(0.0f);
-            glm::vec3 scale = glm::vec3(1.0f);
-            glm::f32 rotation = 0.0f;
-            Sprout::Pivot pivot = Sprout::Pivot::CENTER;
-            bool worldSpace = true;
-            
-            if (e->hasComponent<Comp::Transform>())
-            {
-                auto& cTransform = e->getComponent<Comp::Transform>();
-                pos = cTransform.position + cSprite.transformOffset;
-                scale = cTransform.scale * cSprite.scaleOffset;
-                rotation = cTransform.rotation;
-                pivot = cTransform.pivot;
-            }
-            else if (e->hasComponent<Comp::GUITransform>())
+void Scene::renderEntity(const std::shared_ptr<Entity>& e, glm::f32 currentEnt, glm::f32 numEntities, std::vector<SharedSpriteDraw>& sharedDraws)
+{
+    float dt = m_engine.deltaTime();
+    if (e->hasComponent<Comp::GridTransform>() && e->hasComponent<Comp::Transform>())
+    {
+        auto& gridTransform = e->getComponent<Comp::GridTransform>();
+        auto& transform = e->getComponent<Comp::Transform>();
+        transform.position = gridTransform.getWorldPosition();
+    }
+    
+    if (e->hasComponentEnabled<Comp::Sprite>() && StaticSpriteCache::isCached(*e))
+    {
+        // drawn with the rest of its chunk after the loop
+        sharedDraws.push_back({ e.get(), SharedSpriteDraw::Kind::Static });
+    }
+    else if (e->hasComponentEnabled<Comp::Sprite>())
+    {
+        
+        auto& cSprite = e->getComponent<Comp::Sprite>();
+
+        if (cSprite.type == Comp::Sprite::Type::Animated)
+        {
+            // update the animation frame based on delta time
+            cSprite.animationTime += dt;
+            if (cSprite.animationTime >= (1.0f / cSprite.animationSpeed))
             {
-                auto& cUITransform = e->getComponent<Comp::GUITransform>();
-                worldSpace = false;
-                pos = cUITransform.screenPosition;
-                pivot = cUITransform.pivot;
-                scale = cUITransform.scale;
+                cSprite.currentFrame = (cSprite.currentFrame + 1) % cSprite.numFrames;
+                cSprite.animationTime = 0.0f;
             }
-            
-            if (cSprite.flip_X)
+        }
+        glm::f32 depth = 1 - (static_cast<glm::f32>(cSprite.layer) + currentEnt / numEntities) / static_cast<glm::f32>(Comp::Layer::Count);
+        glm::vec2 pos = glm::vec2(0.0f);
+        glm::vec3 scale = glm::vec3(1.0f);
+        glm::f32 rotation = 0.0f;
+        Sprout::Pivot pivot = Sprout::Pivot::CENTER;
+        bool worldSpace = true;
+        
+        if (e->hasComponent<Comp::Transform>())
+        {
+            auto& cTransform = e->getComponent<Comp::Transform>();
+            pos = cTransform.position + cSprite.transformOffset;
+            scale = cTransform.scale * cSprite.scaleOffset;
+            rotation = cTransform.rotation;
+            pivot = cTransform.pivot;
+        }
+        else if (e->hasComponent<Comp::GUITransform>())
+        {
+            auto& cUITransform = e->getComponent<Comp::GUITransform>();
+            worldSpace = false;
+            pos = cUITransform.screenPosition;
+            pivot = cUITransform.pivot;
+            scale = cUITransform.scale;
+        }
+        
+        if (cSprite.flip_X)
+        {
+            scale.x *= -1;
+        }
+        
+        if (cSprite.retained)
+        {
+            sharedDraws.push_back({ e.get(), SharedSpriteDraw::Kind::Retained, pos, rotation, scale, pivot, worldSpace, (int)cSprite.currentFrame, cSprite.color_override });
+        }
+        else
+        {
+            if (cSprite.slot >= 0)
             {
-                scale.x *= -1;
+                // retained was cleared directly instead of through setRetained, free the slot so it stops drawing
+                sharedDraws.push_back({ e.get(), SharedSpriteDraw::Kind::Release });
             }
-            
             m_engine.getWindow().draw_sprite(cSprite.texture, pos, depth, rotation, (int)cSprite.currentFrame, cSprite.color_override, scale, pivot, worldSpace);
-            
-            if (cSprite.colorOverrideTime > 0)
-            {
-                cSprite.colorOverrideTime -= dt;
-                if (cSprite.colorOverrideTime <= 0)
-                {
-                    cSprite.color_override = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
-                    cSprite.colorOverrideTime = 0;
-                }
-            }
         }
-        if (e->hasComponentEnabled<Comp::Text>())
+        
+        if (cSprite.colorOverrideTime > 0)
         {
-            auto& cText = e->getComponent<Comp::Text>();
-            
-            glm::vec2 pos = glm::vec2(0.0f);
-            float scale = 0.025f * cText.size;
-            Sprout::Pivot pivot = Sprout::Pivot::TOP_LEFT;
-            bool worldSpace = true;
-            float depth = 1 - (static_cast<glm::f32>(cText.layer) + currentEnt / numEntities) / static_cast<glm::f32>(Comp::Layer::Count);
-            
-            if (e->hasComponent<Comp::Transform>())
-            {
-                auto& cTransform = e->getComponent<Comp::Transform>();
-                pos = cTransform.position + cText.transformOffset;
-                pivot = cTransform.pivot;
-            }
-            else if (e->hasComponent<Comp::GUITransform>())
+            cSprite.colorOverrideTime -= dt;
+            if (cSprite.colorOverrideTime <= 0)
             {
-                auto& cUITransform = e->getComponent<Comp::GUITransform>();
-                worldSpace = false;
-                pos = cUITransform.screenPosition + cText.transformOffset;
-                pivot = cUITransform.pivot;
+                cSprite.color_override = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+                cSprite.colorOverrideTime = 0;
             }
-            
-            
-            m_engine.getWindow().draw_text(cText.text, AssetManager::getFont(cText.font), pos, depth, cText.color, scale, pivot, worldSpace, cText.justify);
         }
+    }
+    else if (e->hasComponent<Comp::Sprite>() && e->getComponent<Comp::Sprite>().slot >= 0)
+    {
+        // disabled, hide it until it's enabled again
+        sharedDraws.push_back({ e.get(), SharedSpriteDraw::Kind::Release });
+    }
+    if (e->hasComponentEnabled<Comp::Text>())
+    {
+        auto& cText = e->getComponent<Comp::Text>();
+        
+        glm::vec2 pos = glm::vec2(0.0f);
+        float scale = 0.025f * cText.size;
+        Sprout::Pivot pivot = Sprout::Pivot::TOP_LEFT;
+        bool worldSpace = true;
+        float depth = 1 - (static_cast<glm::f32>(cText.layer) + currentEnt / numEntities) / static_cast<glm::f32>(Comp::Layer::Count);
         
-        if (e->hasComponentEnabled<Comp::Image>())
+        if (e->hasComponent<Comp::Transform>())
         {
-            auto& image = e->getComponent<Comp::Image>();
-            glm::vec2 pos = glm::vec2(0,0);
-            glm::f32 depth = 1 - (static_cast<glm::f32>(image.layer) + currentEnt / numEntities) / static_cast<glm::f32>(Comp::Layer::Count);
-            glm::f32 rotation = 0.0f;
-            glm::vec3 scale = glm::vec3(1);
-            Sprout::Pivot pivot = Sprout::Pivot::TOP_LEFT;
-            
-            if (e->hasComponent<Comp::Transform>())
-            {
-                auto& transform = e->getComponent<Comp::Transform>();
-                pos = transform.position + image.transformOffset;
-                scale = transform.scale * image.scaleOffset;
-                rotation = transform.rotation;
-                pivot = transform.pivot;
-            }
-            m_engine.getWindow().draw_standalone_texture(image.texture, pos, depth, rotation, scale, pivot);
+            auto& cTransform = e->getComponent<Comp::Transform>();
+            pos = cTransform.position + cText.transformOffset;
+            pivot = cTransform.pivot;
         }
-        currentEnt++;
+        else if (e->hasComponent<Comp::GUITransform>())
+        {
+            auto& cUITransform = e->getComponent<Comp::GUITransform>();
+            worldSpace = false;
+            pos = cUITransform.screenPosition + cText.transformOffset;
+            pivot = cUITransform.pivot;
+        }
+        
+        
+        if (cText.fontHandle == nullptr || cText.resolvedFont != cText.font)
+        {
+            cText.fontHandle = AssetManager::getFont(cText.font);
+            cText.resolvedFont = cText.font;
+        }
+        Sprout::Window& window = m_engine.getWindow();
+        window.layout_text(cText.text, cText.fontHandle, scale, cText.layout);
+        window.draw_text_layout(cText.layout, pos, depth, cText.color, scale, pivot, worldSpace, cText.justify);
+    }
+    
+    if (e->hasComponentEnabled<Comp::Image>())
+    {
+        auto& image = e->getComponent<Comp::Image>();
+        glm::vec2 pos = glm::vec2(0,0);
+        glm::f32 depth = 1 - (static_cast<glm::f32>(image.layer) + currentEnt / numEntities) / static_cast<glm::f32>(Comp::Layer::Count);
+        glm::f32 rotation = 0.0f;
+        glm::vec3 scale = glm::vec3(1);
+        Sprout::Pivot pivot = Sprout::Pivot::TOP_LEFT;
+        
+        if (e->hasComponent<Comp::Transform>())
+        {
+            auto& transform = e->getComponent<Comp::Transform>();
+            pos = transform.position + image.transformOffset;
+            scale = transform.scale * image.scaleOffset;
+            rotation = transform.rotation;
+            pivot = transform.pivot;
+        }
+        m_engine.getWindow().draw_standalone_texture(image.texture, pos, depth, rotation, scale, pivot);
+    }
+}
+
+void Scene::renderSharedSprite(const SharedSpriteDraw& draw)
+{
+    auto& cSprite = draw.entity->getComponent<Comp::Sprite>();
+    if (draw.kind == SharedSpriteDraw::Kind::Static)
+    {
+        m_staticSprites.add(*draw.entity);
+        return;
+    }
+    if (draw.kind == SharedSpriteDraw::Kind::Release)
+    {
+        cSprite.releaseSlot();
+        return;
+    }
+    
+    Sprout::Window& window = m_engine.getWindow();
+    if (m_retainedBatch < 0)
+    {
+        m_retainedBatch = window.createRetainedBatch();
+    }
+    if (cSprite.slot < 0 || cSprite.slotBatch != m_retainedBatch)
+    {
+        cSprite.releaseSlot();
+        cSprite.slot = window.acquireSpriteSlot(m_retainedBatch);
+        cSprite.slotBatch = m_retainedBatch;
     }
+    
+    // at the back of the layer, a depth that moved with the entity count would rewrite every slot
+    const glm::f32 retainedDepth = 1 - static_cast<glm::f32>(cSprite.layer) / static_cast<glm::f32>(Comp::Layer::Count);
+    window.update_sprite_slot(m_retainedBatch, cSprite.slot, cSprite.texture, draw.position, retainedDepth, draw.rotation, draw.frame, draw.color, draw.scale, draw.pivot, draw.worldSpace);
 }
\ No newline at end of file
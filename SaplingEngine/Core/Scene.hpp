@@ -11,6 +11,8 @@
 #include "Core/AudioEngine.hpp"
 #include "Utility/Debug.hpp"
 #include "Utility/Physics.hpp"
+#include "Utility/PhysicsWorld.hpp"
+#include "Utility/StaticSpriteCache.hpp"
 #include "ECS/EntityManager.hpp"
 #include "ECS/Entity.hpp"
 #include "ECS/Component.hpp"
@@ -19,8 +21,10 @@
 #include <memory>
 #include <random>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <functional>
+#include <vector>
 #include "Core/SceneMessage.hpp"
 
 class Entity;
@@ -38,6 +42,10 @@ class Scene
     protected:
         std::shared_ptr<EntityManager> m_entityManager; // the scene's entity manager
         Engine& m_engine; // the engine that the scene is running on
+        PhysicsWorld m_physicsWorld; // contact tracking for the scene's colliders
+        StaticSpriteCache m_staticSprites; // static background sprites, drawn as chunks
+        int m_retainedBatch = -1; // the window's batch for retained sprites, made on first use
+        bool m_multithreadedRender = true; // extract draws on the JobSystem, the frame is the same either way
     
     
     public:
@@ -59,10 +67,17 @@ class Scene
         /*
             * Called every frame to render entities
             * Override this function to implement custom rendering, by default it renders all entities with a sprite component (static and animated)
+            * Static background sprites are baked into chunks by the scene's StaticSpriteCache, which is drawn at the end
             * @param entities The list of entities to render
         */
         virtual void sRender(EntityList& entities);
         
+        /*
+            * Called every frame to step physics
+            * Override this function to implement custom physics, by default it steps the scene's physics world and dispatches collision events
+        */
+        virtual void sPhysics();
+        
         virtual void onSceneEnabled();
         virtual void onSceneDisabled();
         
@@ -94,6 +109,49 @@ class Scene
         */
         void postUpdate();
         
+    private:
+        
+        static constexpr size_t RenderGrain = 512; // entities per render job
+        
+        /*
+            * Sprite work that goes through the scene's static or retained caches, which aren't safe to touch from the render jobs.
+            * The jobs record it and sRender finishes it in entity order.
+        */
+        struct SharedSpriteDraw
+        {
+            enum class Kind : std::uint8_t
+            {
+                Static,
+                Retained,
+                Release
+            };
+            
+            Entity* entity = nullptr;
+            Kind kind = Kind::Static;
+            glm::vec2 position = glm::vec2(0.0f);
+            glm::f32 rotation = 0.0f;
+            glm::vec3 scale = glm::vec3(1.0f);
+            Sprout::Pivot pivot = Sprout::Pivot::CENTER;
+            bool worldSpace = true;
+            int frame = 0;
+            glm::vec4 color = glm::vec4(0.0f);
+        };
+        std::vector<std::vector<SharedSpriteDraw>> m_sharedSpriteDraws; // per render job chunk
+        
+        /*
+            * Draws one entity's sprite, text and image into the calling thread's draw stream
+            * @param e The entity
+            * @param currentEnt The index of the entity, orders it within its layer
+            * @param numEntities The number of entities being rendered
+            * @param sharedDraws Where to record the sprite work that has to wait for the jobs to finish
+        */
+        void renderEntity(const std::shared_ptr<Entity>& e, glm::f32 currentEnt, glm::f32 numEntities, std::vector<SharedSpriteDraw>& sharedDraws);
+        
+        /*
+            * Finishes a static or retained sprite recorded by renderEntity
+            * @param draw The recorded sprite
+        */
+        void renderSharedSprite(const SharedSpriteDraw& draw);
         
 };
 
@@ -34,9 +34,9 @@ namespace Comp
     
     glm::vec2 GridTransform::getWorldPosition()
     {
-        int padding = 16;
-        int worldX = x * 32 + padding;
-        int worldY = y * 32 + padding;
+        int padding = CellSize / 2;
+        int worldX = x * CellSize + padding;
+        int worldY = y * CellSize + padding;
         return glm::vec2(worldX, worldY);
     }
 
@@ -62,6 +62,12 @@ namespace Comp
     {
         inst->requestRemoveTag("hascollider");
     }
+    
+    void BBox::wake()
+    {
+        sleeping = false;
+        idleTime = 0.0f;
+    }
         
     BCircle::BCircle(Inst inst, const float radiusIn) 
     :   Component(std::move(inst)),
@@ -107,6 +113,26 @@ namespace Comp
     void Sprite::OnRemoveFromEntity()
     {
         inst->requestRemoveTag("drawable");
+        releaseSlot();
+    }
+    
+    void Sprite::setRetained(const bool retainedIn)
+    {
+        retained = retainedIn;
+        if (!retained)
+        {
+            releaseSlot();
+        }
+    }
+    
+    void Sprite::releaseSlot()
+    {
+        if (slot >= 0 && Sprout::Window::getInstance() != nullptr)
+        {
+            Sprout::Window::getInstance()->releaseSpriteSlot(slotBatch, slot);
+        }
+        slot = -1;
+        slotBatch = -1;
     }
     
     void Sprite::setColorOverride(const glm::vec4& color, const float time)
@@ -17,7 +17,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -72,8 +71,16 @@ namespace Comp
         Transform(Inst inst, const glm::vec2& positionin);
     };
     
+    /*
+        * Places an entity on the level grid, the entity's Transform is snapped to the cell center when rendered.
+        * Solid tiles don't need to be entities, see TileCollisionLayer. Static colliders on the grid can be baked into it, see PhysicsWorld::setBakeGridTiles.
+        * x (int8): The grid column.
+        * y (int8): The grid row.
+    */
     struct GridTransform final : public Component
     {
+        static constexpr int CellSize = 32;
+        
         GridTransform(Inst inst, int8_t x, int8_t y);
         
         int8_t x;
@@ -89,6 +96,8 @@ namespace Comp
         * A bounding box component for collision detection.
         * w (f32): The width of the bounding box.
         * h (f32): The height of the bounding box.
+        * collisionEventsEnabled (bool): Receive onCollision/onTrigger Enter/Stay/Exit events from the PhysicsWorld.
+        * canSleep (bool): Let the PhysicsWorld put the body to sleep once it and everything it touches stays idle.
     */
     struct BBox final : public Component
     {
@@ -98,11 +107,22 @@ namespace Comp
         bool isStatic = true;
         bool interactWithTriggers = false;
         bool collisionEventsEnabled = false;
-        std::unordered_set<BBox*> collidingWith = {};
+        bool canSleep = true;
+        
+        // managed by the PhysicsWorld
+        bool sleeping = false;
+        float idleTime = 0.0f;
+        uint32_t sleepIsland = 0;
+        glm::vec2 sleepPosition = glm::vec2(0.0f);
         
         BBox(Inst inst, float win, float hin);
         void OnAddToEntity() override;
         void OnRemoveFromEntity() override;
+        
+        /*
+            * Wakes the body up, the rest of its island wakes on the next physics step.
+        */
+        void wake();
     };
     
     /*
@@ -129,6 +149,9 @@ namespace Comp
         * currentFrame (size_t): The current frame of the animation.
         * frameSize (size_t): The size of each frame in the animation.
         * animationSpeed (size_t): The speed of the animation.
+        * isStatic (bool): The sprite never moves or animates, on Layer::Background it's baked into a static chunk instead of drawn every frame.
+        * retained (bool): The sprite keeps a slot in the scene's retained batch, which is only rewritten when it changes. Drawn at the back of its layer.
+        * slot (int): The retained slot, -1 until the sprite is first rendered.
     */
     struct Sprite final : public Component 
     {
@@ -143,6 +166,9 @@ namespace Comp
         glm::vec3 scaleOffset = glm::vec3(1.0f, 1.0f, 1.0f);
         
         void setLayer(Layer layerIn) { layer = layerIn; }
+        void setStatic(bool staticIn) { isStatic = staticIn; }
+        void setRetained(bool retainedIn);
+        void releaseSlot();
         void flipX(bool flip) { flip_X = flip; }
         void setColorOverride(const glm::vec4& color, float time);
         void setAnimated(const float animSpeed);
@@ -165,6 +191,10 @@ namespace Comp
         glm::vec4 color_override = Color::Transparent;
         float colorOverrideTime = 0;
         bool flip_X = false;
+        bool isStatic = false;
+        bool retained = false;
+        int slot = -1;
+        int slotBatch = -1;
     };
     
     struct Image final : public Component
@@ -221,6 +251,12 @@ namespace Comp
         glm::vec2 transformOffset = glm::vec2(0, 0);
         Sprout::TextJustify justify = Sprout::TextJustify::LEFT;
         Layer layer = Layer::UserInterface;
+        
+        // kept by Scene::renderEntity between frames, the font is looked up again when its name changes
+        // and the text laid out again when the string or font change
+        std::string resolvedFont = "";
+        std::shared_ptr<Sprout::Font> fontHandle;
+        Sprout::TextLayout layout;
     };
 }
 
@@ -4,6 +4,7 @@
 //
 
 #include "ECS/EntityManager.hpp"
+#include "ECS/Component.hpp"
 
 EntityManager::EntityManager()
 {
@@ -94,6 +95,12 @@ void EntityManager::destroyEntity(const std::shared_ptr<Entity>& entity)
         entityListWithTag.erase(std::remove(entityListWithTag.begin(), entityListWithTag.end(), entity), entityListWithTag.end());
     }
     m_spatialGrid.removeEntity(entity);
+    
+    // components keep their entity alive, so a retained sprite would be drawn forever if its slot weren't freed here
+    if (entity->hasComponent<Comp::Sprite>())
+    {
+        entity->getComponent<Comp::Sprite>().releaseSlot();
+    }
 
     m_entities.erase(std::remove(m_entities.begin(), m_entities.end(), entity), m_entities.end());
 }
@@ -0,0 +1,232 @@
+//
+//  AtlasFormat.hpp
+//  Sapling Engine, Sprout Renderer
+//
+
+//  Shared by the runtime atlas and the AtlasBaker tool, so it must not
+//  depend on sokol or anything else from the renderer.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Sprout
+{
+
+    // pixels extruded around every packed texture
+    const int ATLAS_PADDING = 2;
+
+    /*
+        * Baked atlas file, written by AtlasBaker and mapped by TextureAtlas::loadBaked. Little endian.
+        * BakedAtlasHeader
+        * BakedAtlasEntry[entry_count], sorted by name so lookups can binary search the mapped table
+        * names, not null terminated, at names_offset
+        * RGBA8 pages back to back at pixels_offset, page_size * page_size * 4 bytes each, already padded
+    */
+    const char* const BAKED_ATLAS_FILE = "atlas.sprout";
+    const uint32_t BAKED_ATLAS_MAGIC = 0x54415053; // "SPAT"
+    const uint32_t BAKED_ATLAS_VERSION = 2;
+
+    struct BakedAtlasHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t page_size;
+        uint32_t page_count;
+        uint32_t entry_count;
+        uint32_t names_offset;
+        uint32_t pixels_offset;
+        uint32_t reserved;
+    };
+
+    // x, y, width and height are the packed pixels in the page, inside the padding,
+    // which are the trim rect of the source image after its transparent margins were cut
+    struct BakedAtlasEntry
+    {
+        uint32_t name_offset;
+        uint32_t name_length;
+        uint16_t page;
+        uint16_t x, y;
+        uint16_t width, height;
+        uint16_t source_width, source_height;
+        uint16_t trim_x, trim_y;
+        uint16_t reserved;
+    };
+
+    static_assert(sizeof(BakedAtlasHeader) == 32, "baked atlas header layout changed");
+    static_assert(sizeof(BakedAtlasEntry) == 28, "baked atlas entry layout changed");
+
+    // the part of an image that is packed, in pixels
+    struct AtlasTrim
+    {
+        int x, y;
+        int width, height;
+    };
+
+    /*
+        * Finds the smallest rect holding every pixel of an RGBA8 image that isn't fully transparent
+        * @param pixels The image pixels
+        * @param width The width of the image
+        * @param height The height of the image
+        * @return The rect, empty if the whole image is transparent
+    */
+    inline auto trim_transparent(const unsigned char* pixels, int width, int height) -> AtlasTrim
+    {
+        int min_x = width, min_y = height, max_x = -1, max_y = -1;
+        for (int y = 0; y < height; y++)
+        {
+            const unsigned char* row = pixels + static_cast<size_t>(y) * width * 4;
+            int row_min = -1, row_max = -1;
+            for (int x = 0; x < width; x++)
+            {
+                if (row[x * 4 + 3] != 0)
+                {
+                    row_min = x;
+                    break;
+                }
+            }
+            if (row_min < 0)
+            {
+                continue;
+            }
+            for (int x = width - 1; x >= row_min; x--)
+            {
+                if (row[x * 4 + 3] != 0)
+                {
+                    row_max = x;
+                    break;
+                }
+            }
+            min_x = row_min < min_x ? row_min : min_x;
+            max_x = row_max > max_x ? row_max : max_x;
+            min_y = y < min_y ? y : min_y;
+            max_y = y;
+        }
+
+        if (max_y < 0)
+        {
+            return AtlasTrim{ 0, 0, 0, 0 };
+        }
+        return AtlasTrim{ min_x, min_y, max_x - min_x + 1, max_y - min_y + 1 };
+    }
+
+    /*
+        * Checks if any pixel of an RGBA8 rect is partly transparent, an image without any only needs alpha testing
+        * @param pixels The first pixel of the rect
+        * @param stride The width of the image the pixels are in
+        * @param width The width of the rect
+        * @param height The height of the rect
+        * @return True if an alpha is neither 0 nor 255
+    */
+    inline auto has_partial_alpha(const unsigned char* pixels, int stride, int width, int height) -> bool
+    {
+        for (int y = 0; y < height; y++)
+        {
+            const unsigned char* row = pixels + static_cast<size_t>(y) * stride * 4;
+            for (int x = 0; x < width; x++)
+            {
+                const unsigned char alpha = row[x * 4 + 3];
+                if (alpha != 0 && alpha != 255)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /*
+        * Copies RGBA8 pixels into a page and extends their edges into the padding around them.
+        * @param page The page pixels
+        * @param page_size The width and height of the page
+        * @param pixels The first pixel to copy
+        * @param stride The width of the image the pixels are in, to copy part of it
+        * @param width The width of the copied rect
+        * @param height The height of the copied rect
+        * @param base_x The left of the rect in the page, inside the padding
+        * @param base_y The top of the rect in the page, inside the padding
+    */
+    inline void blit_padded(unsigned char* page, int page_size, const unsigned char* pixels, int stride, int width, int height, int base_x, int base_y)
+    {
+        // copy texture data
+        for (int y = 0; y < height; y++) {
+            memcpy(
+                &page[((base_y + y) * page_size + base_x) * 4],
+                &pixels[static_cast<size_t>(y) * stride * 4],
+                static_cast<size_t>(width) * 4
+            );
+        }
+
+        // extend edges into padding
+
+        // horizontal edges
+        for (int x = 0; x < width; x++) {
+            // T
+            for (int p = 1; p <= ATLAS_PADDING; p++) {
+                int src_index = ((base_y) * page_size + (base_x + x)) * 4;
+                int dst_index = ((base_y - p) * page_size + (base_x + x)) * 4;
+                memcpy(&page[dst_index], &page[src_index], 4);
+            }
+
+            // B
+            for (int p = 1; p <= ATLAS_PADDING; p++) {
+                int src_index = ((base_y + height - 1) * page_size + (base_x + x)) * 4;
+                int dst_index = ((base_y + height - 1 + p) * page_size + (base_x + x)) * 4;
+                memcpy(&page[dst_index], &page[src_index], 4);
+            }
+        }
+
+        // vertical edges
+        for (int y = 0; y < height; y++) {
+            // L
+            for (int p = 1; p <= ATLAS_PADDING; p++) {
+                int src_index = ((base_y + y) * page_size + base_x) * 4;
+                int dst_index = ((base_y + y) * page_size + (base_x - p)) * 4;
+                memcpy(&page[dst_index], &page[src_index], 4);
+            }
+
+            // R
+            for (int p = 1; p <= ATLAS_PADDING; p++) {
+                int src_index = ((base_y + y) * page_size + (base_x + width - 1)) * 4;
+                int dst_index = ((base_y + y) * page_size + (base_x + width - 1 + p)) * 4;
+                memcpy(&page[dst_index], &page[src_index], 4);
+            }
+        }
+
+        // corners
+        for (int py = 1; py <= ATLAS_PADDING; py++) {
+            for (int px = 1; px <= ATLAS_PADDING; px++) {
+                // TL
+                memcpy(
+                    &page[((base_y - py) * page_size + (base_x - px)) * 4],
+                    &page[(base_y * page_size + base_x) * 4],
+                    4
+                );
+
+                // TR
+                memcpy(
+                    &page[((base_y - py) * page_size + (base_x + width - 1 + px)) * 4],
+                    &page[(base_y * page_size + (base_x + width - 1)) * 4],
+                    4
+                );
+
+                // BL
+                memcpy(
+                    &page[((base_y + height - 1 + py) * page_size + (base_x - px)) * 4],
+                    &page[((base_y + height - 1) * page_size + base_x) * 4],
+                    4
+                );
+
+                // BR
+                memcpy(
+                    &page[((base_y + height - 1 + py) * page_size + (base_x + width - 1 + px)) * 4],
+                    &page[((base_y + height - 1) * page_size + (base_x + width - 1)) * 4],
+                    4
+                );
+            }
+        }
+    }
+
+}
@@ -4,12 +4,12 @@
 //
 
 #include "Renderer/Font.hpp"
+#include "Renderer/Sprout.hpp"
 
+// after Sprout.hpp, so stb_truetype uses the stb_rect_pack the texture atlas includes instead of defining its own
 #define STB_TRUETYPE_IMPLEMENTATION
 #include <stb/stb_truetype.h>
 
-#include "Renderer/Sprout.hpp"
-
 #include <fstream>
 #include <iostream>
 #include <vector>
@@ -19,7 +19,6 @@ namespace Sprout
 
     Font::~Font() 
     {
-        free(bakedChars);
         free(data);
     }
     
@@ -46,6 +45,12 @@ namespace Sprout
                 return false;
             }
             memcpy(this->data, buffer.data(), filesize);
+            if (!stbtt_InitFont(&this->info, this->data, stbtt_GetFontOffsetForIndex(this->data, 0)))
+            {
+                free(this->data);
+                this->data = nullptr;
+                return false;
+            }
             this->size = size;
             registerFont();
             return true;
@@ -53,13 +58,13 @@ namespace Sprout
     
     void Font::registerFont()
     {
-        Window::getInstance()->addFont(std::shared_ptr<Font>(this));
+        Window::getInstance()->addFont(shared_from_this());
     }
     
     void Font::release()
     {
-        free(bakedChars);
         free(data);
+        data = nullptr;
     }
 
 }
@@ -6,21 +6,22 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <stb/stb_truetype.h>
 
 namespace Sprout
 {
 
-    class Font
+    class Font : public std::enable_shared_from_this<Font>
     {
 
         public:
-            unsigned char* data;
-            int charCount = 96;
-            stbtt_bakedchar* bakedChars = (stbtt_bakedchar*)malloc(sizeof(stbtt_bakedchar) * charCount);
+            unsigned char* data = nullptr;
+            stbtt_fontinfo info; // glyphs are rasterized from it on first use, see GlyphCache
             uint8_t fontId;
-            float size;
+            float size; // height in pixels text is drawn at with a scale of 1
+            bool sdf = false; // rasterized once as signed distance fields and drawn at any size from those, set before loading
             
             Font() = default;
             ~Font();
@@ -0,0 +1,329 @@
+//
+//  GlyphCache.cpp
+//  Sapling Engine, Sprout Renderer
+//
+
+#include "Renderer/GlyphCache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
+namespace Sprout
+{
+
+    // empty pixels around every glyph so filtering doesn't pick up its neighbours
+    static const int GLYPH_PADDING = 1;
+    // distance field glyphs: pixels of falloff around the outline, and the value on the outline
+    static const int SDF_PADDING = 6;
+    static const unsigned char SDF_ON_EDGE = 128;
+
+    GlyphCache::GlyphCache(int pageSize, int maxPages)
+        :   m_pageSize(pageSize),
+            m_maxPages(std::min(maxPages, 32))
+    {
+    }
+
+    GlyphCache::~GlyphCache()
+    {
+        if (m_image.id != SG_INVALID_ID && sg_isvalid())
+        {
+            sg_destroy_image(m_image);
+        }
+    }
+
+    auto GlyphCache::get(const Font& font, int pixelSize, uint32_t codepoint) -> const Glyph&
+    {
+        const uint64_t key = (static_cast<uint64_t>(font.fontId) << 48) | (static_cast<uint64_t>(pixelSize) << 32) | codepoint;
+        auto it = m_glyphs.find(key);
+        if (it != m_glyphs.end())
+        {
+            if (it->second.page >= 0)
+            {
+                m_pages[it->second.page].lastUsed = m_frame;
+            }
+            return it->second;
+        }
+
+        const float scale = stbtt_ScaleForPixelHeight(&font.info, static_cast<float>(pixelSize));
+        int advance, lsb, x0, y0, x1, y1;
+        stbtt_GetCodepointHMetrics(&font.info, static_cast<int>(codepoint), &advance, &lsb);
+
+        // distance fields carry their own padding, the distance to the edge falls off across it
+        unsigned char* sdf = nullptr;
+        if (font.sdf)
+        {
+            int width = 0, height = 0, xoff = 0, yoff = 0;
+            sdf = stbtt_GetCodepointSDF(&font.info, scale, static_cast<int>(codepoint), SDF_PADDING, SDF_ON_EDGE, static_cast<float>(SDF_ON_EDGE) / SDF_PADDING, &width, &height, &xoff, &yoff);
+            x0 = xoff;
+            y0 = yoff;
+            x1 = xoff + (sdf != nullptr ? width : 0);
+            y1 = yoff + (sdf != nullptr ? height : 0);
+        }
+        else
+        {
+            stbtt_GetCodepointBitmapBox(&font.info, static_cast<int>(codepoint), scale, scale, &x0, &y0, &x1, &y1);
+        }
+
+        Glyph glyph;
+        glyph.offset = glm::vec2(x0, y0);
+        glyph.size = glm::vec2(x1 - x0, y1 - y0);
+        glyph.uv = glm::vec4(0.0f);
+        glyph.advance = advance * scale;
+        glyph.page = -1;
+
+        // whitespace has nothing to rasterize, and a glyph bigger than a page is left out rather than cut
+        const int width = x1 - x0;
+        const int height = y1 - y0;
+        int x = 0, y = 0;
+        if (width > 0 && height > 0)
+        {
+            glyph.page = place(width + GLYPH_PADDING * 2, height + GLYPH_PADDING * 2, x, y);
+        }
+        if (glyph.page >= 0)
+        {
+            x += GLYPH_PADDING;
+            y += GLYPH_PADDING;
+            const unsigned char* bitmap = sdf;
+            if (bitmap == nullptr)
+            {
+                m_bitmap.resize(static_cast<size_t>(width) * height);
+                stbtt_MakeCodepointBitmap(&font.info, m_bitmap.data(), width, height, width, scale, scale, static_cast<int>(codepoint));
+                bitmap = m_bitmap.data();
+            }
+
+            unsigned char* page_pixels = m_pixels.data() + static_cast<size_t>(glyph.page) * m_pageSize * m_pageSize * 4;
+            for (int row = 0; row < height; row++)
+            {
+                unsigned char* dst = page_pixels + (static_cast<size_t>(y + row) * m_pageSize + x) * 4;
+                for (int col = 0; col < width; col++)
+                {
+                    dst[col * 4 + 0] = 255;
+                    dst[col * 4 + 1] = 255;
+                    dst[col * 4 + 2] = 255;
+                    dst[col * 4 + 3] = bitmap[static_cast<size_t>(row) * width + col];
+                }
+            }
+
+            const float inv = 1.0f / static_cast<float>(m_pageSize);
+            glyph.uv = glm::vec4(x * inv, y * inv, (x + width) * inv, (y + height) * inv);
+            m_pages[glyph.page].lastUsed = m_frame;
+            m_dirty = true;
+        }
+        if (sdf != nullptr)
+        {
+            stbtt_FreeSDF(sdf, nullptr);
+        }
+
+        return m_glyphs.emplace(key, glyph).first->second;
+    }
+
+    auto GlyphCache::touch(uint32_t pages, uint32_t generation) -> bool
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        if (generation != m_generation.load())
+        {
+            for (uint32_t rest = pages, page = 0; rest != 0; page++, rest >>= 1)
+            {
+                if ((rest & 1) && m_pages[page].clearedAt > generation)
+                {
+                    return false;
+                }
+            }
+        }
+        for (int page = 0; pages != 0; page++, pages >>= 1)
+        {
+            if (pages & 1)
+            {
+                m_pages[page].lastUsed = m_frame;
+            }
+        }
+        return true;
+    }
+
+    void GlyphCache::beginFrame()
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_frame++;
+    }
+
+    auto GlyphCache::place(int width, int height, int& x, int& y) -> int
+    {
+        if (width > m_pageSize || height > m_pageSize)
+        {
+            return -1;
+        }
+        for (size_t page = 0; page < m_pages.size(); page++)
+        {
+            if (placeIn(m_pages[page], width, height, x, y))
+            {
+                return static_cast<int>(page);
+            }
+        }
+
+        // open a page while there's room for one, then clear the one used least recently
+        if (static_cast<int>(m_pages.size()) < m_maxPages)
+        {
+            m_pages.emplace_back();
+            m_pixels.resize(m_pages.size() * m_pageSize * m_pageSize * 4, 0);
+            placeIn(m_pages.back(), width, height, x, y);
+            return static_cast<int>(m_pages.size()) - 1;
+        }
+        int oldest = -1;
+        for (size_t page = 0; page < m_pages.size(); page++)
+        {
+            if (m_pages[page].lastUsed < m_frame && (oldest < 0 || m_pages[page].lastUsed < m_pages[oldest].lastUsed))
+            {
+                oldest = static_cast<int>(page);
+            }
+        }
+        if (oldest < 0)
+        {
+            return -1; // everything is on screen this frame
+        }
+        clearPage(oldest);
+        placeIn(m_pages[oldest], width, height, x, y);
+        return oldest;
+    }
+
+    auto GlyphCache::placeIn(Page& page, int width, int height, int& x, int& y) -> bool
+    {
+        // the first shelf the glyph fits without wasting more than a third of its height
+        for (Shelf& shelf : page.shelves)
+        {
+            if (height <= shelf.height && height * 3 >= shelf.height * 2 && shelf.x + width <= m_pageSize)
+            {
+                x = shelf.x;
+                y = shelf.y;
+                shelf.x += width;
+                return true;
+            }
+        }
+        if (page.top + height > m_pageSize)
+        {
+            return false;
+        }
+        page.shelves.push_back({ page.top, height, width });
+        x = 0;
+        y = page.top;
+        page.top += height;
+        return true;
+    }
+
+    void GlyphCache::clearPage(int page)
+    {
+        for (auto it = m_glyphs.begin(); it != m_glyphs.end();)
+        {
+            it = it->second.page == page ? m_glyphs.erase(it) : std::next(it);
+        }
+        m_pages[page].shelves.clear();
+        m_pages[page].top = 0;
+        std::memset(m_pixels.data() + static_cast<size_t>(page) * m_pageSize * m_pageSize * 4, 0, static_cast<size_t>(m_pageSize) * m_pageSize * 4);
+        m_pages[page].clearedAt = ++m_generation;
+        m_dirty = true;
+    }
+
+    auto GlyphCache::upload() -> bool
+    {
+        // the image always needs a layer to be bindable
+        if (m_pages.empty())
+        {
+            m_pages.emplace_back();
+            m_pixels.resize(static_cast<size_t>(m_pageSize) * m_pageSize * 4, 0);
+            m_dirty = true;
+        }
+        if (!m_dirty)
+        {
+            return false;
+        }
+
+        if (m_imagePages != getPageCount())
+        {
+            if (m_image.id != SG_INVALID_ID)
+            {
+                sg_destroy_image(m_image);
+            }
+
+            sg_image_desc img_desc = {};
+            img_desc.type = SG_IMAGETYPE_ARRAY;
+            img_desc.width = m_pageSize;
+            img_desc.height = m_pageSize;
+            img_desc.num_slices = getPageCount();
+            img_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
+            img_desc.usage = SG_USAGE_DYNAMIC;
+            img_desc.label = "glyph-pages";
+
+            m_image = sg_make_image(&img_desc);
+            m_imagePages = getPageCount();
+        }
+
+        // array layers are uploaded together, so every page goes up even if only one glyph changed
+        sg_image_data data = {};
+        data.subimage[0][0].ptr = m_pixels.data();
+        data.subimage[0][0].size = m_pixels.size();
+        sg_update_image(m_image, &data);
+
+        m_dirty = false;
+        return true;
+    }
+
+    auto GlyphCache::decodeUtf8(const std::string& text, size_t& i) -> uint32_t
+    {
+        const unsigned char lead = static_cast<unsigned char>(text[i]);
+        int length;
+        uint32_t codepoint;
+        if (lead < 0x80)
+        {
+            i++;
+            return lead;
+        }
+        else if ((lead & 0xE0) == 0xC0)
+        {
+            length = 2;
+            codepoint = lead & 0x1F;
+        }
+        else if ((lead & 0xF0) == 0xE0)
+        {
+            length = 3;
+            codepoint = lead & 0x0F;
+        }
+        else if ((lead & 0xF8) == 0xF0)
+        {
+            length = 4;
+            codepoint = lead & 0x07;
+        }
+        else
+        {
+            i++;
+            return 0xFFFD;
+        }
+
+        if (i + length > text.size())
+        {
+            i++;
+            return 0xFFFD;
+        }
+        for (int k = 1; k < length; k++)
+        {
+            const unsigned char next = static_cast<unsigned char>(text[i + k]);
+            if ((next & 0xC0) != 0x80)
+            {
+                i++;
+                return 0xFFFD;
+            }
+            codepoint = (codepoint << 6) | (next & 0x3F);
+        }
+
+        // overlong forms, surrogates and anything past the last plane
+        static const uint32_t min_codepoint[] = { 0, 0, 0x80, 0x800, 0x10000 };
+        if (codepoint < min_codepoint[length] || (codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF)
+        {
+            i++;
+            return 0xFFFD;
+        }
+        i += length;
+        return codepoint;
+    }
+
+}
@@ -0,0 +1,144 @@
+//
+//  GlyphCache.hpp
+//  Sapling Engine, Sprout Renderer
+//
+
+#pragma once
+
+#include "Renderer/Font.hpp"
+
+#include "glm/glm.hpp"
+#include "sokol/sokol_gfx.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Sprout
+{
+
+    /*
+        * Glyphs rasterized on first use into the layers of a 2D array image, keyed by font, pixel size and codepoint.
+        * Each page is packed in shelves, rows as tall as the first glyph put in them. When every page is full the one
+        * used least recently is cleared whole and its glyphs rasterized again when next needed, a page used this frame
+        * is never cleared. Laid out text remembers the generation of the cache, which moves on whenever a page is cleared,
+        * so it only has to be laid out again if one of its own pages was cleared since.
+        * Glyphs of sdf fonts are signed distance fields instead of coverage, in the alpha of the same pages.
+        * Like TextureAtlas the pages are kept on the CPU and sent as a whole when any of them changed.
+        * Every call but upload can be made from any thread.
+    */
+    class GlyphCache
+    {
+        public:
+            /*
+                * Creates an empty cache, no GPU work is done until upload.
+                * @param pageSize The width and height of a page in pixels
+                * @param maxPages The number of pages after which pages are reused
+            */
+            GlyphCache(int pageSize = 512, int maxPages = 8);
+            ~GlyphCache();
+
+            GlyphCache(const GlyphCache&) = delete;
+            GlyphCache& operator=(const GlyphCache&) = delete;
+
+            // a rasterized glyph, metrics are in pixels at the size it was rasterized at
+            struct Glyph
+            {
+                glm::vec2 offset; // top left corner from the pen position on the baseline
+                glm::vec2 size;
+                glm::vec4 uv;
+                float advance;
+                int page; // -1 if the glyph has no pixels or didn't fit
+            };
+
+            /*
+                * Finds a glyph, rasterizing it if it isn't cached. Call with the lock held, see lock.
+                * @param font The font, its fontId is part of the key
+                * @param pixelSize The height of the font in pixels
+                * @param codepoint The unicode codepoint
+                * @return The glyph
+            */
+            auto get(const Font& font, int pixelSize, uint32_t codepoint) -> const Glyph&;
+
+            /*
+                * Guards get, held over a whole layout so a page can't be cleared halfway through it
+                * @return The lock
+            */
+            auto lock() -> std::unique_lock<std::mutex> { return std::unique_lock<std::mutex>(m_mutex); }
+
+            /*
+                * Marks pages used this frame so they aren't cleared while its quads point at them
+                * @param pages A bit per page
+                * @param generation The generation the pages were looked up in
+                * @return False if one of the pages was cleared since, the text has to be laid out again
+            */
+            auto touch(uint32_t pages, uint32_t generation) -> bool;
+
+            auto getGeneration() const -> uint32_t { return m_generation.load(); }
+
+            /*
+                * Starts a frame, pages used before it may be cleared again. Called before the update.
+            */
+            void beginFrame();
+
+            /*
+                * Sends the pages to the GPU if a glyph was added since the last call, creating the image on first use.
+                * Only call it after sg_setup, at most once per frame and while no other thread uses the cache.
+                * @return True if anything was uploaded
+            */
+            auto upload() -> bool;
+
+            /*
+                * Gets the array image holding the pages, only valid after upload
+                * @return The image
+            */
+            auto getImage() const -> sg_image { return m_image; }
+
+            auto getPageCount() const -> int { return static_cast<int>(m_pages.size()); }
+
+            /*
+                * Decodes the codepoint at i and moves i past it. Malformed sequences decode to U+FFFD one byte at a time.
+                * @param text UTF-8 text
+                * @param i The byte index, less than the size of text
+                * @return The codepoint
+            */
+            static auto decodeUtf8(const std::string& text, size_t& i) -> uint32_t;
+
+        private:
+            struct Shelf
+            {
+                int y, height, x;
+            };
+
+            struct Page
+            {
+                std::vector<Shelf> shelves;
+                int top = 0; // where the next shelf opens
+                uint64_t lastUsed = 0;
+                uint32_t clearedAt = 0; // the generation it was last cleared in
+            };
+
+            int m_pageSize;
+            int m_maxPages;
+            std::vector<Page> m_pages;
+            std::vector<unsigned char> m_pixels; // every page back to back, RGBA
+            std::unordered_map<uint64_t, Glyph> m_glyphs;
+            std::vector<unsigned char> m_bitmap; // scratch for one rasterized glyph
+            std::mutex m_mutex;
+
+            uint64_t m_frame = 1;
+            std::atomic<uint32_t> m_generation = 0;
+
+            sg_image m_image = {};
+            int m_imagePages = 0;
+            bool m_dirty = false;
+
+            auto place(int width, int height, int& x, int& y) -> int;
+            auto placeIn(Page& page, int width, int height, int& x, int& y) -> bool;
+            void clearPage(int page);
+    };
+
+}
@@ -6,7 +6,11 @@
 #include "Renderer/StandaloneTexture.hpp"
 #include "Utility/Debug.hpp"
 #include <cstddef>
-#if defined(__APPLE__)
+#if defined(SAPLING_HEADLESS)
+    // no window or GPU, sokol_gfx validates and tracks resources but draws nothing
+    #define SOKOL_DUMMY_BACKEND
+    #define SOKOL_GFX_IMPL
+#elif defined(__APPLE__)
     #define SOKOL_METAL
 #elif defined(_WIN32)
     #define SOKOL_D3D11
@@ -19,15 +23,23 @@
 #define SOKOL_NO_ENTRY
 #include "sokol/sokol_gfx.h"
 #include "sokol/sokol_app.h"
+#ifndef SAPLING_HEADLESS
 #include "sokol/sokol_glue.h"
+#endif
 
 
 #include "Renderer/Sprout.hpp"
 #include "Utility/Color.hpp"
 #include "Renderer/quad.h"
 
+#include "stb/stb_image_write.h"
+
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <iostream>
+#include <stdexcept>
 
 namespace Sprout 
 {
@@ -70,7 +82,7 @@ namespace Sprout
             m_viewportHeight(viewportHeight)
         {    
             memset(&m_state, 0, sizeof(m_state));
-            memset(&draw_frame, 0, sizeof(draw_frame));
+            setQuadCapacity(DEFAULT_QUAD_CAPACITY);
     
             m_viewportAspectRatio = static_cast<float>(m_viewportWidth) / static_cast<float>(m_viewportHeight);
             
@@ -94,7 +106,10 @@ namespace Sprout
     
     Window::~Window()
     {
-        delete Instance;
+        if (Instance == this)
+        {
+            Instance = nullptr;
+        }
     }
     
     void Window::init_cb()
@@ -105,6 +120,13 @@ namespace Sprout
     void Window::frame_cb()
     {
         Instance->Frame();
+        Instance->m_frames_run++;
+        #ifndef SAPLING_HEADLESS
+        if (Instance->m_frame_limit > 0 && Instance->m_frames_run == Instance->m_frame_limit)
+        {
+            sapp_request_quit();
+        }
+        #endif
     }
     
     void Window::cleanup_cb()
@@ -123,40 +145,36 @@ namespace Sprout
         updateViewport();
         
         sg_desc desc = {};
+        #ifdef SAPLING_HEADLESS
+        desc.environment.defaults.color_format = SG_PIXELFORMAT_RGBA8;
+        desc.environment.defaults.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+        desc.environment.defaults.sample_count = 1;
+        #else
         desc.environment = sglue_environment();   
+        #endif
         sg_setup(&desc);
 
 
-        // main vertex buffer for regular quads
-        sg_buffer_desc vbuf_desc = {};
-        vbuf_desc.size = sizeof(draw_frame.quads);
-        vbuf_desc.usage = SG_USAGE_DYNAMIC;
-        vbuf_desc.label = "quad-vertices";
+        // every quad is the unit quad expanded per instance by the vertex shader
+        const std::array<glm::vec2, 4> corners = {
+            glm::vec2(0.0f, 0.0f),
+            glm::vec2(0.0f, 1.0f),
+            glm::vec2(1.0f, 1.0f),
+            glm::vec2(1.0f, 0.0f)
+        };
         
-        m_state.quad_vbuf = sg_make_buffer(&vbuf_desc);
+        sg_buffer_desc corner_desc = {};
+        corner_desc.size = sizeof(corners);
+        corner_desc.data = SG_RANGE(corners);
+        corner_desc.label = "quad-corners";
         
-        // separate vertex buffer for standalone quads
-        sg_buffer_desc standalone_vbuf_desc = {};
-        standalone_vbuf_desc.size = sizeof(draw_frame.standalone_quads);
-        standalone_vbuf_desc.usage = SG_USAGE_DYNAMIC;
-        standalone_vbuf_desc.label = "standalone-quad-vertices";
+        m_state.corner_vbuf = sg_make_buffer(&corner_desc);
         
-        m_state.standalone_vbuf = sg_make_buffer(&standalone_vbuf_desc);
+        // one stream buffer for every instance batch, each frame appends only what was drawn
+        make_instance_buffer(m_quad_capacity);
         
         // index buffer
-        const int INDEX_BUFFER_COUNT = MAX_QUADS * 6 + MAX_STANDALONE_TEXTURES * 6;
-        std::array<glm::u16, INDEX_BUFFER_COUNT> indices;
-        
-        for (int i = 0; i < INDEX_BUFFER_COUNT;)
-        {
-            indices.at(i + 0) = ((i/6)*4 + 0);
-    		indices.at(i + 1) = ((i/6)*4 + 1);
-    		indices.at(i + 2) = ((i/6)*4 + 2);
-    		indices.at(i + 3) = ((i/6)*4 + 0);
-    		indices.at(i + 4) = ((i/6)*4 + 2);
-    		indices.at(i + 5) = ((i/6)*4 + 3);
-    		i += 6;
-        }
+        const std::array<glm::u16, 6> indices = { 0, 1, 2, 0, 2, 3 };
         
         sg_buffer_desc ibuf_desc = {};
         ibuf_desc.type = SG_BUFFERTYPE_INDEXBUFFER;
@@ -175,17 +193,36 @@ namespace Sprout
         
         m_state.bind.samplers[SMP_default_sampler] = sg_make_sampler(&sampler_desc);
         
+        // distance field glyphs are interpolated between texels, and their padding keeps neighbours out
+        sampler_desc.min_filter = SG_FILTER_LINEAR;
+        sampler_desc.mag_filter = SG_FILTER_LINEAR;
+        sampler_desc.wrap_u = SG_WRAP_CLAMP_TO_EDGE;
+        sampler_desc.wrap_v = SG_WRAP_CLAMP_TO_EDGE;
+        m_state.bind.samplers[SMP_glyph_sampler] = sg_make_sampler(&sampler_desc);
+        
         // pipeline
-        sg_shader shd = sg_make_shader(quad_shader_desc(sg_query_backend()));
+        // the dummy backend compiles nothing, any backend's desc passes its validation
+        const sg_backend backend = sg_query_backend() == SG_BACKEND_DUMMY ? SG_BACKEND_GLCORE : sg_query_backend();
+        sg_shader shd = sg_make_shader(quad_shader_desc(backend));
         
         sg_pipeline_desc pip_desc = {};
         pip_desc.shader = shd;
         pip_desc.index_type = SG_INDEXTYPE_UINT16;
-        pip_desc.layout.attrs[ATTR_quad_position0].format = SG_VERTEXFORMAT_FLOAT4;
-        pip_desc.layout.attrs[ATTR_quad_color0].format = SG_VERTEXFORMAT_FLOAT4;
-        pip_desc.layout.attrs[ATTR_quad_uv0].format = SG_VERTEXFORMAT_FLOAT2;
-        pip_desc.layout.attrs[ATTR_quad_color_override0].format = SG_VERTEXFORMAT_FLOAT4;
+        pip_desc.layout.buffers[1].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+        pip_desc.layout.attrs[ATTR_quad_corner0].format = SG_VERTEXFORMAT_FLOAT2;
+        pip_desc.layout.attrs[ATTR_quad_corner0].buffer_index = 0;
+        pip_desc.layout.attrs[ATTR_quad_pos0].format = SG_VERTEXFORMAT_FLOAT2;
+        pip_desc.layout.attrs[ATTR_quad_pos0].buffer_index = 1;
+        pip_desc.layout.attrs[ATTR_quad_size_scale0].format = SG_VERTEXFORMAT_HALF4;
+        pip_desc.layout.attrs[ATTR_quad_size_scale0].buffer_index = 1;
+        pip_desc.layout.attrs[ATTR_quad_rot_depth0].format = SG_VERTEXFORMAT_SHORT2N;
+        pip_desc.layout.attrs[ATTR_quad_rot_depth0].buffer_index = 1;
+        pip_desc.layout.attrs[ATTR_quad_uv_rect0].format = SG_VERTEXFORMAT_USHORT4N;
+        pip_desc.layout.attrs[ATTR_quad_uv_rect0].buffer_index = 1;
+        pip_desc.layout.attrs[ATTR_quad_color_override0].format = SG_VERTEXFORMAT_UBYTE4N;
+        pip_desc.layout.attrs[ATTR_quad_color_override0].buffer_index = 1;
         pip_desc.layout.attrs[ATTR_quad_bytes0].format = SG_VERTEXFORMAT_UBYTE4N;
+        pip_desc.layout.attrs[ATTR_quad_bytes0].buffer_index = 1;
         pip_desc.label = "quad-pipeline";
 
         
@@ -200,105 +237,654 @@ namespace Sprout
         
         pip_desc.colors[0].blend = blend_state;    
         
+        // translucent quads are tested against what the opaque pass wrote but don't write themselves
+        pip_desc.depth.compare = SG_COMPAREFUNC_LESS_EQUAL;
+        pip_desc.depth.write_enabled = false;
         
         m_state.pip = sg_make_pipeline(&pip_desc);
         
+        // opaque quads replace what they cover, so the blend is off and depth is written
+        pip_desc.colors[0].blend = {};
+        pip_desc.depth.write_enabled = true;
+        pip_desc.label = "quad-opaque-pipeline";
+        
+        m_state.opaque_pip = sg_make_pipeline(&pip_desc);
+        
         sg_pass_action pass_action = {};
         pass_action.colors[0].load_action = SG_LOADACTION_CLEAR;
         pass_action.colors[0].clear_value = {0.0f, 0.0f, 0.0f, 1.0f};
+        pass_action.depth.load_action = SG_LOADACTION_CLEAR;
+        pass_action.depth.clear_value = 1.0f;
 
         m_state.pass_action = pass_action;
 
 
-        // bake images into atlas
-        bake_atlas();
-        init_fonts();
-    }
-    
-    bool sortByZ(const Quad& a, const Quad& b)
-    {
-        return a.vertices[0].pos.z > b.vertices[0].pos.z;
+        // every image slot has to be bound, draws that don't sample one get a blank image
+        const uint32_t white_pixel = 0xFFFFFFFF;
+        sg_image_desc blank_desc = {};
+        blank_desc.width = 1;
+        blank_desc.height = 1;
+        blank_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
+        blank_desc.data.subimage[0][0] = SG_RANGE(white_pixel);
+        blank_desc.label = "blank-image";
+        
+        m_state.blank_img = sg_make_image(&blank_desc);
+        for (int slot = 0; slot < IMAGE_SLOTS; slot++)
+        {
+            m_state.bind.images[IMG_image0 + slot] = m_state.blank_img;
+        }
+        
+        // pack everything added so far in one batch and upload it, later textures are uploaded by Frame
+        if (!m_atlas.pack())
+        {
+            throw std::runtime_error("Failed to pack rects");
+        }
+        m_atlas.upload();
+        
+        #ifdef DEBUG
+        for (int i = 0; i < m_atlas.getPageCount(); i++)
+        {
+            std::string filename = "atlas" + std::to_string(i) + ".png";
+            stbi_write_png(filename.c_str(), m_atlas.getPageSize(), m_atlas.getPageSize(), 4, m_atlas.getPagePixels(i), m_atlas.getPageSize() * 4);
+        }
+        #endif
     }
     
     void Window::Frame()
     {
-        // reset draw frame
-        draw_frame.num_quads = 0;
-        std::fill(draw_frame.quads.begin(), draw_frame.quads.end(), Quad{});
-        
-        draw_frame.num_images = 0;
-        std::fill(draw_frame.standalone_quads.begin(), draw_frame.standalone_quads.end(), Quad{});
-        for (size_t i = 0; i < MAX_STANDALONE_TEXTURES; i++)
-        {
-            draw_frame.images[i].id = SG_INVALID_ID;
-        }
+        const auto frame_start = std::chrono::steady_clock::now();
         
         // delta time calculation (not smoothed like sapp_frame_duration())
         // should be running at constant 60 fps, but just in case
         auto now = std::chrono::system_clock::now();
+        #ifdef SAPLING_HEADLESS
+        m_delta_time = 1.0 / 60.0;
+        #else
         m_delta_time = std::chrono::duration<double>(now - m_last_frame_time).count();
+        #endif
         m_last_frame_time = now;
         
+        if (!m_pipelined)
+        {
+            simulate_frame(m_delta_time);
+            prepare_render(draw_frame);
+            render_frame(draw_frame);
+            m_frame_stats = m_render_stats;
+            m_frame_stats.cpu_frame_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frame_start).count();
+            return;
+        }
+        
+        if (!m_sim_thread.joinable())
+        {
+            // the frames swap, so both get the capacity setQuadCapacity gave one
+            m_render_frame.quads.resize(draw_frame.quads.size());
+            m_render_frame.sort_keys.resize(draw_frame.sort_keys.size());
+            m_sim_thread = std::thread(&Window::sim_loop, this);
+        }
+        
+        // handoff: the simulation is idle from here until it's started again, so this is where shared state changes hands
+        bool has_frame = false;
+        {
+            std::unique_lock<std::mutex> lock(m_sim_mutex);
+            m_sim_done.wait(lock, [this] { return !m_sim_pending; });
+            has_frame = m_sim_has_frame;
+            m_sim_has_frame = false;
+        }
+        
+        for (const sapp_event& e : m_pending_events)
+        {
+            dispatch_event(&e);
+        }
+        m_pending_events.clear();
+        
+        // the render that just finished is the last finished frame
+        m_frame_stats = m_render_stats;
+        if (has_frame)
+        {
+            // take the finished frame, the simulation keeps the camera and viewport it left behind
+            std::swap(draw_frame, m_render_frame);
+            draw_frame.view_projection = m_render_frame.view_projection;
+            draw_frame.camera_xform = m_render_frame.camera_xform;
+            draw_frame.viewport = m_render_frame.viewport;
+            prepare_render(m_render_frame);
+        }
+        
+        // simulate frame N+1 while frame N is submitted
+        {
+            std::lock_guard<std::mutex> lock(m_sim_mutex);
+            m_sim_dt = m_delta_time;
+            m_sim_pending = true;
+        }
+        m_sim_wake.notify_one();
+        
+        if (has_frame)
+        {
+            render_frame(m_render_frame);
+            m_render_stats.cpu_frame_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frame_start).count();
+        }
+    }
+    
+    void Window::simulate_frame(double dt)
+    {
+        const auto update_start = std::chrono::steady_clock::now();
+
+        // reset draw frame, quads are overwritten as they're drawn so only the counts need clearing
+        draw_frame.num_quads = 0;
+        draw_frame.num_images = 0;
+        draw_frame.images.clear();
+        m_glyph_cache.beginFrame();
+        m_dropped_draws = 0;
+        m_culled_draws = 0;
+        m_submitted_draws = 0;
+        draw_frame.static_chunks.clear();
+        for (const int batch : draw_frame.retained_batches)
+        {
+            m_retained_batches[batch].queued = false;
+        }
+        draw_frame.retained_batches.clear();
+        
         if (m_update_frame_callback) 
         {
-            m_update_frame_callback(m_delta_time);
+            m_update_frame_callback(dt);
         }
         
-        // sort quads by z so we have layers (z buffer alternative to keep transparency)
-        std::sort(draw_frame.quads.begin(), draw_frame.quads.begin() + draw_frame.num_quads, sortByZ);
-        std::sort(draw_frame.standalone_quads.begin(), draw_frame.standalone_quads.begin() + draw_frame.num_images, sortByZ);
+        m_update_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - update_start).count();
+    }
+    
+    void Window::sim_loop()
+    {
+        std::unique_lock<std::mutex> lock(m_sim_mutex);
+        while (true)
+        {
+            m_sim_wake.wait(lock, [this] { return m_sim_pending || m_sim_stopping; });
+            if (m_sim_stopping)
+            {
+                return;
+            }
+            const double dt = m_sim_dt;
+            lock.unlock();
+            
+            simulate_frame(dt);
+            
+            lock.lock();
+            m_sim_pending = false;
+            m_sim_has_frame = true;
+            m_sim_done.notify_all();
+        }
+    }
+    
+    void Window::prepare_render(const DrawFrame& frame)
+    {
+        const auto prepare_start = std::chrono::steady_clock::now();
+        m_render_stats = FrameStats();
+        m_render_stats.update_ms = m_update_ms;
+        m_render_stats.culled_draws = m_culled_draws;
+        m_render_stats.submitted_draws = m_submitted_draws;
+        m_render_stats.dropped_draws = m_dropped_draws;
         
-        m_state.bind.images[IMG_fontTex1] = m_fontAtlases[0].img;
+        // gpu resources asked for during the simulation are made and destroyed here, on the render thread
+        for (const sg_buffer buffer : m_pending_destroys)
+        {
+            sg_destroy_buffer(buffer);
+        }
+        m_pending_destroys.clear();
+        for (StaticChunk& chunk : m_static_chunks)
+        {
+            if (chunk.in_use && !chunk.pending.empty())
+            {
+                sg_buffer_desc vbuf_desc = {};
+                vbuf_desc.data = { chunk.pending.data(), sizeof(QuadInstance) * chunk.pending.size() };
+                vbuf_desc.usage = SG_USAGE_IMMUTABLE;
+                vbuf_desc.label = "static-chunk-instances";
+                chunk.buffer = sg_make_buffer(&vbuf_desc);
+                std::vector<QuadInstance>().swap(chunk.pending);
+            }
+        }
+        
+        // textures and glyphs added since the last frame were packed on the CPU, send them before drawing
+        m_atlas.upload();
+        m_state.bind.images[IMG_atlasPages9] = m_atlas.getImage();
+        m_glyph_cache.upload();
+        m_state.bind.images[IMG_fontPages8] = m_glyph_cache.getImage();
+        
+        // what the render reads of the static chunks and retained batches, the simulation may change them while it runs
+        m_render_chunks.clear();
+        for (const int chunk : frame.static_chunks)
+        {
+            m_render_chunks.push_back({ m_static_chunks[chunk].buffer, m_static_chunks[chunk].num_quads, m_static_chunks[chunk].num_opaque });
+            m_render_stats.static_quads += m_static_chunks[chunk].num_quads;
+        }
+        m_render_stats.static_chunks = static_cast<int>(m_render_chunks.size());
+        
+        m_render_batches.clear();
+        for (const int batch : frame.retained_batches)
+        {
+            RetainedBatch& retained = m_retained_batches[batch];
+            m_render_stats.upload_bytes += upload_retained_batch(retained);
+            m_render_batches.push_back({ retained.keys, retained.buffer });
+            m_render_stats.retained_quads += static_cast<int>(retained.keys.size());
+        }
+        
+        // world quads go through the camera, screen space quads only through the projection
+        m_render_world_vp = camera_matrices().world_vp;
+        m_render_stats.submit_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - prepare_start).count();
+    }
+    
+    void Window::render_frame(DrawFrame& frame)
+    {
+        const auto submit_start = std::chrono::steady_clock::now();
+
+        // sort quads by key so we have layers, then gather them once into the buffer that gets uploaded,
+        // opaque quads first for the depth tested pass, then the rest in the back to front order blending needs
+        if (m_sorted_quads.size() < frame.quads.size())
+        {
+            m_sort_scratch.resize(frame.quads.size());
+            m_translucent_keys.resize(frame.quads.size());
+            m_sorted_quads.resize(frame.quads.size());
+        }
+        const uint64_t* quad_keys = radix_sort_keys(frame.sort_keys.data(), m_sort_scratch.data(), frame.num_quads);
+        const int num_opaque = gather_passes(quad_keys, frame.num_quads, frame.quads.data(), m_sorted_quads.data(), m_translucent_keys.data());
+        
+        bind_image_slots(frame, num_opaque);
+
+        // stream buffers can't be resized, replace it before anything is appended this frame
+        if (frame.num_quads > m_buffer_quad_capacity)
+        {
+            sg_destroy_buffer(m_state.instance_vbuf);
+            make_instance_buffer(std::max(frame.num_quads, m_buffer_quad_capacity * 2));
+        }
+
+        // upload only the used range
+        int quad_offset = 0;
+        if (frame.num_quads > 0)
+        {
+            const sg_range range = { m_sorted_quads.data(), sizeof(QuadInstance) * frame.num_quads };
+            quad_offset = sg_append_buffer(m_state.instance_vbuf, &range);
+            m_render_stats.upload_bytes += range.size;
+        }
 
-        sg_update_buffer(m_state.quad_vbuf, SG_RANGE(draw_frame.quads));
+        vs_params_t vs_params;
+        memcpy(vs_params.world_vp, &m_render_world_vp[0][0], sizeof(vs_params.world_vp));
+        memcpy(vs_params.screen_vp, &frame.view_projection[0][0], sizeof(vs_params.screen_vp));
+
+        // appends past the end of the buffer are dropped by sokol
+        if (sg_query_buffer_overflow(m_state.instance_vbuf))
+        {
+            m_render_stats.dropped_draws += frame.num_quads;
+        }
 
         // only called once
         sg_pass pass = {};
         pass.action = m_state.pass_action;
 
+        #ifdef SAPLING_HEADLESS
+        pass.swapchain.width = getWidth();
+        pass.swapchain.height = getHeight();
+        pass.swapchain.sample_count = 1;
+        pass.swapchain.color_format = SG_PIXELFORMAT_RGBA8;
+        pass.swapchain.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+        #else
         pass.swapchain = sglue_swapchain();
+        #endif
         sg_begin_pass(&pass);
         
-        glm::vec4 viewport = draw_frame.viewport;
+        glm::vec4 viewport = frame.viewport;
         sg_apply_viewport((int)viewport.x, (int)viewport.y, (int)viewport.z, (int)viewport.w, true);
         sg_apply_scissor_rect((int)viewport.x, (int)viewport.y, (int)viewport.z, (int)viewport.w, true);
         
+        const sg_range vs_params_range = SG_RANGE(vs_params);
+        m_state.bind.vertex_buffers[0] = m_state.corner_vbuf;
+        
+        // opaque pass, static chunks and this frame's quads front to back, each with one draw
+        sg_apply_pipeline(m_state.opaque_pip);
+        sg_apply_uniforms(UB_vs_params, &vs_params_range);
+        for (const RenderChunk& chunk : m_render_chunks)
+        {
+            if (chunk.num_opaque > 0)
+            {
+                m_state.bind.vertex_buffers[1] = chunk.buffer;
+                m_state.bind.vertex_buffer_offsets[1] = 0;
+                sg_apply_bindings(&m_state.bind);
+                sg_draw(0, 6, chunk.num_opaque);
+                m_render_stats.draw_calls++;
+                m_render_stats.opaque_quads += chunk.num_opaque;
+            }
+        }
+        if (num_opaque > 0)
+        {
+            m_state.bind.vertex_buffers[1] = m_state.instance_vbuf;
+            m_state.bind.vertex_buffer_offsets[1] = quad_offset;
+            sg_apply_bindings(&m_state.bind);
+            sg_draw(0, 6, num_opaque);
+            m_render_stats.draw_calls++;
+            m_render_stats.opaque_quads += num_opaque;
+        }
+        
+        // translucent pass, blended back to front over the opaque pass
         sg_apply_pipeline(m_state.pip);
+        sg_apply_uniforms(UB_vs_params, &vs_params_range);
+        m_state.bind.vertex_buffers[1] = m_state.instance_vbuf;
 
-        // draw standalone textures
-        if (draw_frame.num_images > 0) {
-            sg_update_buffer(m_state.standalone_vbuf, SG_RANGE(draw_frame.standalone_quads));
-            m_state.bind.vertex_buffers[0] = m_state.standalone_vbuf;
-
-            for (int i = 0; i < draw_frame.num_images; i++) {
-                if (draw_frame.images[i].id != SG_INVALID_ID) {
-                    m_state.bind.images[IMG_texture0] = draw_frame.images[i];
-                    sg_apply_bindings(&m_state.bind);
-                    sg_draw(i * 6, 6, 1);
+        // static chunks sit under everything sorted this frame, each is already in order in its own buffer
+        for (const RenderChunk& chunk : m_render_chunks)
+        {
+            if (chunk.num_quads > chunk.num_opaque)
+            {
+                m_state.bind.vertex_buffers[1] = chunk.buffer;
+                m_state.bind.vertex_buffer_offsets[1] = chunk.num_opaque * static_cast<int>(sizeof(QuadInstance));
+                sg_apply_bindings(&m_state.bind);
+                sg_draw(0, 6, chunk.num_quads - chunk.num_opaque);
+                m_render_stats.draw_calls++;
+            }
+        }
+        
+        // the quads of this frame and of each retained batch are sorted on their own, merge them by key,
+        // drawing a run from one source until another has a quad that goes first.
+        // Runs of this frame's quads also end where they need another set of standalone images
+        struct DrawSource
+        {
+            const uint64_t* keys;
+            int count;
+            int cursor;
+            sg_buffer buffer;
+            int offset;
+        };
+        std::vector<DrawSource> sources;
+        sources.push_back({ m_translucent_keys.data(), frame.num_quads - num_opaque, 0, m_state.instance_vbuf, quad_offset + num_opaque * static_cast<int>(sizeof(QuadInstance)) });
+        for (const RenderBatch& batch : m_render_batches)
+        {
+            sources.push_back({ batch.keys.data(), static_cast<int>(batch.keys.size()), 0, batch.buffer, 0 });
+        }
+        size_t image_set = 0;
+        while (true)
+        {
+            DrawSource* next = nullptr;
+            uint64_t limit = UINT64_MAX;
+            for (DrawSource& source : sources)
+            {
+                if (source.cursor == source.count)
+                {
+                    continue;
+                }
+                const uint64_t key = source.keys[source.cursor];
+                if (next == nullptr || key < next->keys[next->cursor])
+                {
+                    if (next != nullptr)
+                    {
+                        limit = std::min(limit, next->keys[next->cursor]);
+                    }
+                    next = &source;
                 }
+                else
+                {
+                    limit = std::min(limit, key);
+                }
+            }
+            if (next == nullptr)
+            {
+                break;
             }
+            
+            const int start = next->cursor;
+            int end = next->count;
+            if (next == &sources[0])
+            {
+                while (m_image_sets[image_set].end <= start)
+                {
+                    image_set++;
+                }
+                end = std::min(end, m_image_sets[image_set].end);
+                for (int slot = 0; slot < IMAGE_SLOTS; slot++)
+                {
+                    m_state.bind.images[IMG_image0 + slot] = m_image_sets[image_set].images[slot];
+                }
+            }
+            while (next->cursor < end && next->keys[next->cursor] <= limit)
+            {
+                next->cursor++;
+            }
+            m_state.bind.vertex_buffers[1] = next->buffer;
+            m_state.bind.vertex_buffer_offsets[1] = next->offset + start * static_cast<int>(sizeof(QuadInstance));
+            sg_apply_bindings(&m_state.bind);
+            sg_draw(0, 6, next->cursor - start);
+            m_render_stats.draw_calls++;
+        }
+        m_state.bind.vertex_buffers[1] = m_state.instance_vbuf;
+        // the images may be destroyed before the next frame binds its own
+        for (int slot = 0; slot < IMAGE_SLOTS; slot++)
+        {
+            m_state.bind.images[IMG_image0 + slot] = m_state.blank_img;
         }
-        m_state.bind.images[IMG_texture0] = m_atlas.img;
-        m_state.bind.vertex_buffers[0] = m_state.quad_vbuf;
-        m_state.bind.vertex_buffer_offsets[0] = 0;
-        sg_apply_bindings(&m_state.bind);
-        sg_draw(0, 6 * draw_frame.num_quads, 1);
         
 
 
         // called once
         sg_end_pass();
         sg_commit();
+
+        const auto frame_end = std::chrono::steady_clock::now();
+        m_render_stats.num_quads = frame.num_quads;
+        m_render_stats.num_images = frame.num_images;
+        m_render_stats.quad_capacity = m_buffer_quad_capacity;
+        m_render_stats.submit_ms += std::chrono::duration<double, std::milli>(frame_end - submit_start).count();
+    }
+    
+    void Window::make_instance_buffer(int quad_capacity)
+    {
+        sg_buffer_desc vbuf_desc = {};
+        vbuf_desc.size = sizeof(QuadInstance) * static_cast<size_t>(quad_capacity);
+        vbuf_desc.usage = SG_USAGE_STREAM;
+        vbuf_desc.label = "quad-instances";
+        
+        m_state.instance_vbuf = sg_make_buffer(&vbuf_desc);
+        m_buffer_quad_capacity = quad_capacity;
+    }
+    
+    void Window::bind_image_slots(DrawFrame& frame, int num_opaque)
+    {
+        // standalone images are all translucent, walk them in draw order giving each image a slot,
+        // starting another set when the slots run out
+        m_image_sets.clear();
+        ImageSet set;
+        set.images.fill(m_state.blank_img);
+        std::array<int, IMAGE_SLOTS> set_layers;
+        int used = 0;
+        std::vector<int>& slots = m_image_slot_of;
+        slots.assign(frame.images.size(), -1);
+        
+        const int count = frame.num_quads - num_opaque;
+        for (int i = 0; i < count; i++)
+        {
+            QuadInstance& instance = m_sorted_quads[num_opaque + i];
+            if ((instance.bytes.x & ~TEXTURE_FLAG_OPAQUE) != TEXTURE_INDEX_IMAGE)
+            {
+                continue;
+            }
+            const int layer = instance.bytes.w;
+            if (slots[layer] < 0)
+            {
+                if (used == IMAGE_SLOTS)
+                {
+                    set.end = i;
+                    m_image_sets.push_back(set);
+                    set.images.fill(m_state.blank_img);
+                    for (int slot = 0; slot < IMAGE_SLOTS; slot++)
+                    {
+                        slots[set_layers[slot]] = -1;
+                    }
+                    used = 0;
+                }
+                slots[layer] = used;
+                set_layers[used] = layer;
+                set.images[used] = frame.images[layer];
+                used++;
+            }
+            instance.bytes.w = static_cast<uint8_t>(slots[layer]);
+        }
+        set.end = std::numeric_limits<int>::max();
+        m_image_sets.push_back(set);
+    }
+    
+    auto Window::upload_retained_batch(RetainedBatch& batch) -> size_t
+    {
+        // depth, texture or visibility changed somewhere, sort the visible slots again and rewrite the lot
+        if (batch.order_dirty)
+        {
+            std::vector<uint64_t> keys, scratch;
+            for (size_t slot = 0; slot < batch.instances.size(); slot++)
+            {
+                batch.positions[slot] = -1;
+                if (batch.visible[slot])
+                {
+                    keys.push_back(make_sort_key(batch.instances[slot], static_cast<uint32_t>(slot)));
+                }
+            }
+            scratch.resize(keys.size());
+            const uint64_t* sorted_keys = radix_sort_keys(keys.data(), scratch.data(), static_cast<int>(keys.size()));
+            
+            batch.keys.assign(sorted_keys, sorted_keys + keys.size());
+            batch.ordered.resize(keys.size());
+            for (size_t i = 0; i < batch.keys.size(); i++)
+            {
+                const uint32_t slot = static_cast<uint32_t>(batch.keys[i]);
+                batch.positions[slot] = static_cast<int>(i);
+                batch.ordered[i] = batch.instances[slot];
+            }
+            batch.dirty_end = static_cast<int>(batch.ordered.size());
+            batch.order_dirty = false;
+        }
+        
+        const int count = static_cast<int>(batch.ordered.size());
+        if (count > batch.capacity)
+        {
+            if (batch.buffer.id != SG_INVALID_ID)
+            {
+                sg_destroy_buffer(batch.buffer);
+            }
+            batch.capacity = std::max(count, batch.capacity * 2);
+            
+            sg_buffer_desc vbuf_desc = {};
+            vbuf_desc.size = sizeof(QuadInstance) * static_cast<size_t>(batch.capacity);
+            vbuf_desc.usage = SG_USAGE_DYNAMIC;
+            vbuf_desc.label = "retained-instances";
+            batch.buffer = sg_make_buffer(&vbuf_desc);
+            
+            batch.stale_end.fill(0);
+            batch.dirty_end = count;
+        }
+        if (batch.dirty_end == 0)
+        {
+            return 0;
+        }
+        
+        // buffers can only be updated from the start, so send everything up to the last change the copy hasn't seen
+        for (int& stale_end : batch.stale_end)
+        {
+            stale_end = std::max(stale_end, batch.dirty_end);
+        }
+        batch.dirty_end = 0;
+        
+        const int upload_end = std::min(batch.stale_end[batch.next_copy], count);
+        if (upload_end == 0)
+        {
+            return 0;
+        }
+        batch.stale_end[batch.next_copy] = 0;
+        batch.next_copy = (batch.next_copy + 1) % SG_NUM_INFLIGHT_FRAMES;
+        
+        const sg_range range = { batch.ordered.data(), sizeof(QuadInstance) * static_cast<size_t>(upload_end) };
+        sg_update_buffer(batch.buffer, &range);
+        return range.size;
+    }
+    
+    void Window::setQuadCapacity(int capacity)
+    {
+        m_quad_capacity = std::max(capacity, 1);
+        if (static_cast<int>(draw_frame.quads.size()) < m_quad_capacity)
+        {
+            draw_frame.quads.resize(m_quad_capacity);
+            draw_frame.sort_keys.resize(m_quad_capacity);
+        }
+        
+        // once running, grow the instance buffer now rather than on the first frame that needs it
+        if (m_state.instance_vbuf.id != SG_INVALID_ID && m_quad_capacity > m_buffer_quad_capacity)
+        {
+            sg_destroy_buffer(m_state.instance_vbuf);
+            make_instance_buffer(m_quad_capacity);
+        }
     }
     
     void Window::Cleanup()
     {
+        if (m_sim_thread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_sim_mutex);
+                m_sim_stopping = true;
+            }
+            m_sim_wake.notify_one();
+            m_sim_thread.join();
+        }
         sg_shutdown();
     }
     
+    void Window::setPipelined(bool pipelined)
+    {
+        assert(!m_sim_thread.joinable() && "pipelining is set before Run");
+        m_pipelined = pipelined;
+    }
+    
+    void Window::setFrameLimit(int frames)
+    {
+        m_frame_limit = std::max(frames, 0);
+    }
+    
+    void Window::parseArguments(int argc, char** argv)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+            {
+                setFrameLimit(std::atoi(argv[++i]));
+            }
+            else
+            {
+                Debug::log(std::string("unknown argument: ") + argv[i]);
+            }
+        }
+    }
+    
+    int Window::getWidth() const
+    {
+        #ifdef SAPLING_HEADLESS
+        return m_viewportWidth;
+        #else
+        return sapp_width();
+        #endif
+    }
+    
+    int Window::getHeight() const
+    {
+        #ifdef SAPLING_HEADLESS
+        return m_viewportHeight;
+        #else
+        return sapp_height();
+        #endif
+    }
+    
     void Window::Event(const sapp_event* e)
     {
-        
+        // the simulation may be running, it gets its events at the next handoff
+        if (m_pipelined)
+        {
+            m_pending_events.push_back(*e);
+            return;
+        }
+        dispatch_event(e);
+    }
+    
+    void Window::dispatch_event(const sapp_event* e)
+    {
         if (m_event_callback) 
         {
             m_event_callback(e);
@@ -336,7 +922,43 @@ namespace Sprout
     
     void Window::Run()
     {
+        #ifdef SAPLING_HEADLESS
+        // nothing can ask a headless run to quit, without a limit it would never return
+        if (m_frame_limit <= 0)
+        {
+            std::cerr << "headless runs need a frame limit, pass --frames N" << std::endl;
+            return;
+        }
+        
+        // the same callbacks sokol_app would make, back to back, without a window or events
+        init_cb();
+        FrameStats total;
+        while (m_frames_run < m_frame_limit)
+        {
+            frame_cb();
+            total.cpu_frame_ms += m_frame_stats.cpu_frame_ms;
+            total.update_ms += m_frame_stats.update_ms;
+            total.submit_ms += m_frame_stats.submit_ms;
+            total.num_quads += m_frame_stats.num_quads;
+            total.draw_calls += m_frame_stats.draw_calls;
+            total.upload_bytes += m_frame_stats.upload_bytes;
+            total.dropped_draws += m_frame_stats.dropped_draws;
+        }
+        cleanup_cb();
+        
+        // printed in release builds too, that's where benchmarks run
+        const double frames = std::max(m_frames_run, 1);
+        std::cout << "headless: " << m_frames_run << " frames"
+            << ", cpu " << total.cpu_frame_ms / frames << " ms"
+            << ", update " << total.update_ms / frames << " ms"
+            << ", submit " << total.submit_ms / frames << " ms"
+            << ", quads " << total.num_quads / frames
+            << ", draw calls " << total.draw_calls / frames
+            << ", upload " << total.upload_bytes / frames << " bytes"
+            << ", dropped draws " << total.dropped_draws << std::endl;
+        #else
         sapp_run(sokol_main());
+        #endif
     }
 
 
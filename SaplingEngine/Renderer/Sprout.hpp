@@ -5,8 +5,10 @@
 
 #pragma once
 #include "Renderer/Font.hpp"
+#include "Renderer/GlyphCache.hpp"
 #include "Renderer/StandaloneTexture.hpp"
 #include "Renderer/Texture.hpp"
+#include "Renderer/TextureAtlas.hpp"
 #include "Utility/Color.hpp"
 
 #include "glm/fwd.hpp"
@@ -19,7 +21,11 @@
 #include <cstdint>
 #include <memory>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <array>
+#include <vector>
 
 #include "sokol/sokol_gfx.h"
 #include "sokol/sokol_app.h"
@@ -31,77 +37,133 @@
 namespace Sprout 
 {
     
-    const int MAX_QUADS = 8192;
-    const int MAX_STANDALONE_TEXTURES = 100;
-    //const int MAX_VERTS = MAX_QUADS * 4;
+    const int DEFAULT_QUAD_CAPACITY = 8192;
+    const int MAX_FRAME_IMAGES = 256; // distinct standalone textures a frame can draw
+    const int IMAGE_SLOTS = 8; // standalone textures bound per draw call, matching image0 to image7 of quad.glsl
+    // pixel heights text is rasterized at, smaller or bigger text is scaled from these
+    const int MIN_GLYPH_SIZE = 6;
+    const int MAX_GLYPH_SIZE = 256;
+    // pixel height distance field fonts are rasterized at, every size is drawn from it
+    const int SDF_GLYPH_SIZE = 48;
+    
+    // texture indices in QuadInstance::bytes, matching the image slots of quad.glsl
+    const uint8_t TEXTURE_INDEX_IMAGE = 0;
+    const uint8_t TEXTURE_INDEX_FONT = 1;
+    const uint8_t TEXTURE_INDEX_ATLAS = 2;
+    const uint8_t TEXTURE_INDEX_SDF_FONT = 3;
+    // added to the texture index of quads drawn in the opaque pass, which discards their transparent pixels
+    const uint8_t TEXTURE_FLAG_OPAQUE = 128;
         
     
     struct State 
     {
-        sg_pipeline pip;
+        sg_pipeline pip; // translucent quads, depth tested and blended back to front
+        sg_pipeline opaque_pip; // opaque quads, depth tested and written front to back without blending
         sg_bindings bind;
         sg_pass_action pass_action;
-        sg_buffer quad_vbuf;
-        sg_buffer standalone_vbuf;
+        sg_buffer corner_vbuf;
+        sg_buffer instance_vbuf;
+        sg_image blank_img; // 1x1 white, bound to image slots a draw doesn't sample
     };
     
     /*
-        * Vertex struct for Sprout.
-        * pos (vec4): position of the vertex.
-        * color (vec4): color of the vertex.
-        * uv (vec2): uv coordinates of the vertex.
-        * color_override (vec4): color override of the vertex.
+        * FrameStats struct for Sprout, filled in at the end of every frame.
+        * cpu_frame_ms (f64): CPU time of the whole frame, including the update callback.
+        * update_ms (f64): CPU time of the update callback, where the game records its draws.
+        * submit_ms (f64): CPU time spent sorting, uploading and issuing draws.
+        * num_quads (int): the number of quads drawn from this frame's draws, standalone textures included.
+        * num_images (int): the number of those that were standalone textures.
+        * draw_calls (int): the number of sg_draw calls.
+        * upload_bytes (size_t): the number of instance bytes uploaded to the GPU.
+        * dropped_draws (int): the number of draws dropped, either past MAX_FRAME_IMAGES distinct standalone textures or because the instance buffer overflowed.
+        * culled_draws (int): the number of sprite, rectangle, text, image and static chunk draws skipped for being outside the camera, a text counts once.
+        * submitted_draws (int): the number of those draws that were in view and recorded.
+        * static_chunks (int): the number of static chunks drawn, a draw call for their opaque quads and one for the rest.
+        * static_quads (int): the number of quads those chunks held, not part of num_quads or upload_bytes.
+        * retained_quads (int): the number of quads drawn from retained batches, not part of num_quads. Their uploads are part of upload_bytes.
+        * opaque_quads (int): the number of quads drawn in the opaque pass, from this frame's quads and the static chunks.
+        * quad_capacity (int): the number of quads the instance buffer currently holds.
     */
-    struct Vertex 
+    struct FrameStats
     {
-        glm::vec4 pos;
-        glm::vec4 color;
-        glm::vec2 uv;
-        glm::vec4 color_override;
-        uint8_t bytes;
-        uint8_t padding[3];
-        
+        double cpu_frame_ms = 0.0;
+        double update_ms = 0.0;
+        double submit_ms = 0.0;
+        int num_quads = 0;
+        int num_images = 0;
+        int draw_calls = 0;
+        size_t upload_bytes = 0;
+        int dropped_draws = 0;
+        int culled_draws = 0;
+        int submitted_draws = 0;
+        int static_chunks = 0;
+        int static_quads = 0;
+        int retained_quads = 0;
+        int opaque_quads = 0;
+        int quad_capacity = 0;
     };
     
     /*
-        * Quad struct for Sprout.
-        * vertices (array<Vertex, 4>): the vertices of the quad.
+        * QuadInstance struct for Sprout, one per drawn quad. The vertex shader expands it over the unit quad.
+        * Everything but the position is quantized to keep the record at 36 bytes.
+        * pos (vec2): position of the pivot.
+        * size_scale (u16vec4): half floats, xy is the size of the frame in pixels, zw the scale.
+        * rot_depth (i16vec2): snorm16, x is the rotation divided by pi, y the depth.
+        * uv (u16vec4): unorm16 uv coordinates of the (0,0) and (1,1) corners of the quad.
+        * color_override (u8vec4): unorm8 color override of the quad.
+        * bytes (u8vec4): texture index plus TEXTURE_FLAG_OPAQUE, screen space flag (255), pivot as x * 3 + y in halves of the frame,
+          then the layer: the atlas page, the glyph cache page, or the standalone texture, an index into the frame's images until render_frame makes it an image slot.
     */
-    struct Quad 
+    struct QuadInstance 
     {
-        std::array<Vertex, 4> vertices;
+        glm::vec2 pos;
+        glm::u16vec4 size_scale;
+        glm::i16vec2 rot_depth;
+        glm::u16vec4 uv;
+        glm::u8vec4 color_override;
+        glm::u8vec4 bytes;
     };
     
     /*
-        * Atlas struct for Sprout.
-        * width (int): width of the atlas.
-        * height (int): height of the atlas.
-        * img (sg_image): the image of the atlas.
+        * StaticChunk struct for Sprout, quads recorded once into an immutable instance buffer, see Window::beginStaticChunk.
+        * buffer (sg_buffer): the instances, the opaque ones front to back then the rest back to front. Invalid if the chunk is empty.
+        * num_quads (int): the number of instances in the buffer.
+        * num_opaque (int): the number of those drawn in the opaque pass.
+        * bounds (vec4): min x, min y, max x, max y of the quads in world space, to cull the chunk as a whole.
+        * in_use (bool): false once the chunk is released, so its slot can be reused.
     */
-    struct Atlas 
+    struct StaticChunk
     {
-        int width, height;
-        sg_image img;
+        sg_buffer buffer = {};
+        int num_quads = 0;
+        int num_opaque = 0;
+        glm::vec4 bounds = glm::vec4(0.0f);
+        bool in_use = false;
+        std::vector<QuadInstance> pending; // sorted instances waiting for the buffer to be made
     };
     
     /*
         * DrawFrame struct for Sprout.
-        * quads (array<Quad, MAX_QUADS>): the quads to draw.
-        * num_quads (int): the number of quads to draw.
-        * view_projection (mat4): the view projection matrix.
+        * quads (vector<QuadInstance>): the atlas quads to draw, in submission order. Grows as needed and is never shrunk.
+        * sort_keys (vector<u64>): the draw order key of each quad, see Window::make_sort_key.
+        * num_quads (int): the number of quads to draw, the vectors may be larger.
+        * view_projection (mat4): the view projection matrix, used alone for screen space quads.
         * camera_xform (mat4): the camera transform matrix.
     */
     struct DrawFrame
     {
-        std::array<Quad, MAX_QUADS> quads;
+        std::vector<QuadInstance> quads;
+        std::vector<uint64_t> sort_keys;
         int num_quads = 0;
         glm::mat4 view_projection;
         glm::mat4 camera_xform;
         glm::vec4 viewport; // x, y, width, height
         
-        std::array<Quad, MAX_STANDALONE_TEXTURES> standalone_quads; // for standalone textures
-        sg_image images[MAX_STANDALONE_TEXTURES]; // for standalone textures, indexed by ID
-        int num_images = 0; // number of standalone textures
+        std::vector<sg_image> images; // distinct standalone textures, indexed by the layer of their quads
+        int num_images = 0; // number of standalone texture quads among the quads
+        
+        std::vector<int> static_chunks; // ids drawn this frame, in submission order
+        std::vector<int> retained_batches; // ids drawn this frame
     };
     
     /*
@@ -127,6 +189,65 @@ namespace Sprout
         RIGHT
     };
     
+    /*
+        * TextGlyph struct for Sprout, one glyph of a laid out string.
+        * offset (vec2): top left corner of the glyph from the start of the baseline, unscaled.
+        * size (vec2): size of the glyph in pixels.
+        * uv (vec4): uvs of the glyph in its glyph cache page.
+        * page (u8): the glyph cache page.
+    */
+    struct TextGlyph
+    {
+        glm::vec2 offset;
+        glm::vec2 size;
+        glm::vec4 uv;
+        uint8_t page;
+    };
+    
+    /*
+        * TextLayout struct for Sprout, a string laid out in a font once and kept to draw it every frame, see Window::layout_text.
+        * The glyphs only depend on the string, the font and the pixel size the scale rounds to, justify and the rest only move them.
+        * Distance field fonts always use SDF_GLYPH_SIZE, so only the string and font matter for them.
+        * text (string): the UTF-8 string laid out.
+        * font (Font*): the font it was laid out in, null until the first layout.
+        * pixel_size (int): the height of the font its glyphs were rasterized at.
+        * pixel_scale (f32): the font's size over pixel_size, what the glyphs are scaled by on top of the draw's scale.
+        * glyphs (vector<TextGlyph>): the glyphs that have pixels, in string order.
+        * size (vec2): advance of the whole string and height of its tallest glyph, in pixels at pixel_size.
+        * generation (u32), pages (u32): the glyph cache generation the glyphs were looked up in and a bit per page they sit in.
+        * instances (vector<QuadInstance>): the quads of the last draw, drawn again as they are while the draw inputs don't change.
+    */
+    struct TextLayout
+    {
+        std::string text;
+        const Font* font = nullptr;
+        int pixel_size = 0;
+        float pixel_scale = 1.0f;
+        std::vector<TextGlyph> glyphs;
+        glm::vec2 size = glm::vec2(0.0f);
+        uint32_t generation = 0;
+        uint32_t pages = 0;
+        
+        // what the instances were built from
+        struct DrawInputs
+        {
+            glm::vec2 position = glm::vec2(0.0f);
+            float depth = 0.0f;
+            glm::vec4 color = glm::vec4(0.0f);
+            float scale = 0.0f;
+            Pivot pivot = Pivot::TOP_LEFT;
+            bool world_space = true;
+            TextJustify justify = TextJustify::LEFT;
+            glm::vec2 viewport = glm::vec2(0.0f);
+            
+            bool operator==(const DrawInputs& other) const = default;
+        };
+        DrawInputs inputs;
+        glm::vec2 origin = glm::vec2(0.0f);
+        std::vector<QuadInstance> instances;
+        bool built = false;
+    };
+    
     glm::vec2 getPivotOffset(Pivot pivot);
     glm::vec2 getAnchorOffset(Pivot pivot);
     
@@ -159,14 +280,46 @@ namespace Sprout
             */
             void SetEventCallback(EventCallback cb);
             
+            /*
+                * Runs the update callback on a thread of its own, one frame ahead of the render.
+                * While frame N is sorted, uploaded and submitted, frame N+1 is simulated into the other DrawFrame,
+                * they're swapped once both are done, so what's on screen is one frame behind the simulation.
+                * Events are queued and handed to the event callback at the swap, when the update isn't running.
+                * GPU resources can't be made from the update while pipelined: load standalone textures before Run.
+                * @param pipelined True to pipeline, off by default, must be set before Run
+            */
+            void setPipelined(bool pipelined);
+            
+            /*
+                * Stops after a number of frames, for benchmarks and tests. Windowed the app is asked to quit,
+                * headless (built with SAPLING_HEADLESS) Run returns and logs the averages of the frame stats.
+                * Headless frames advance the update by a fixed 1/60 s so runs are repeatable.
+                * @param frames The number of frames, 0 to run until quit, must be set before Run. Headless runs need one, without it Run logs an error and returns.
+            */
+            void setFrameLimit(int frames);
+            auto getFrameLimit() const -> int { return m_frame_limit; }
+            
+            /*
+                * Reads the window's options from the command line, --frames N sets the frame limit. Unknown arguments are logged and skipped.
+                * @param argc The argument count from main
+                * @param argv The arguments from main
+            */
+            void parseArguments(int argc, char** argv);
+            
             static auto sokol_main() -> sapp_desc;
             
             /*
-                * Adds a texture to the window
+                * Adds a texture to the window and packs it into the atlas, before or after Run
                 * @param tex The texture to add
             */            
             void addTexture(std::shared_ptr<Sprout::Texture> tex);
             
+            /*
+                * Gets the texture atlas, to load a baked atlas into it or look textures up
+                * @return The atlas
+            */
+            auto getAtlas() -> TextureAtlas& { return m_atlas; }
+            
             /*
                 * Adds a font to the window
                 * @param font The font to add
@@ -212,6 +365,23 @@ namespace Sprout
                 * Renders a text string to the screen.
             */
             void draw_text(const std::string& text, const std::shared_ptr<Font>& font, glm::vec2 position, float depth, glm::vec4 color, float scale = 1.0f, Pivot pivot = Pivot::TOP_LEFT, bool worldSpace = true, TextJustify justify = TextJustify::LEFT);
+            
+            /*
+                * Lays a string out in a font, rasterizing glyphs not in the glyph cache yet.
+                * Does nothing if the layout already holds that string in that font at the same pixel size.
+                * @param text The string, UTF-8
+                * @param font The font
+                * @param scale The scale it will be drawn at, picks the pixel size together with the font's size unless the font is a distance field
+                * @param layout The layout to fill, kept by the caller between frames
+            */
+            void layout_text(const std::string& text, const std::shared_ptr<Font>& font, float scale, TextLayout& layout);
+            
+            /*
+                * Renders laid out text, like draw_text. The quads are only rebuilt when an argument differs from the last draw
+                * of the layout, otherwise they're copied into the frame as they are.
+                * @param layout The layout, from layout_text
+            */
+            void draw_text_layout(TextLayout& layout, glm::vec2 position, float depth, glm::vec4 color, float scale = 1.0f, Pivot pivot = Pivot::TOP_LEFT, bool worldSpace = true, TextJustify justify = TextJustify::LEFT);
 
             /*
                 * Draws a standalone texture to the screen.
@@ -234,6 +404,97 @@ namespace Sprout
             );
 
             
+            /*
+                * Starts recording a static chunk. Until endStaticChunk, sprites and rectangles are recorded into
+                * the chunk instead of the frame and aren't culled, the chunk is culled as a whole when drawn.
+                * Chunks are world space and can only be made while the window is running.
+            */
+            void beginStaticChunk();
+            
+            /*
+                * Finishes recording a static chunk and uploads its quads once into an immutable buffer.
+                * @return The id of the chunk, for draw_static_chunk and releaseStaticChunk
+            */
+            auto endStaticChunk() -> int;
+            
+            /*
+                * Destroys a static chunk's buffer, its id may be handed out again.
+                * @param chunk The id of the chunk
+            */
+            void releaseStaticChunk(int chunk);
+            
+            /*
+                * Draws a static chunk this frame with one draw call, culled by its bounds. Chunks are drawn in the order
+                * they are submitted, under every other quad, so they suit background layers.
+                * @param chunk The id of the chunk
+            */
+            void draw_static_chunk(int chunk);
+            
+            /*
+                * Creates a retained batch, sprite slots kept between frames in their own GPU buffer.
+                * A slot is only rewritten when what it draws changes and only the changed part of the buffer is uploaded.
+                * @return The id of the batch
+            */
+            auto createRetainedBatch() -> int;
+            
+            /*
+                * Gets a slot in a retained batch, it draws nothing until update_sprite_slot is called on it
+                * @param batch The id of the batch
+                * @return The id of the slot
+            */
+            auto acquireSpriteSlot(int batch) -> int;
+            
+            /*
+                * Hides a slot and hands its id out again
+                * @param batch The id of the batch
+                * @param slot The id of the slot
+            */
+            void releaseSpriteSlot(int batch, int slot);
+            
+            /*
+                * Sets what a retained slot draws, the same as a draw_sprite call that stays until changed.
+                * Does nothing if nothing changed since the last call. Slots aren't culled.
+            */
+            void update_sprite_slot(
+                int batch,
+                int slot,
+                const std::shared_ptr<Sprout::Texture>& texture,
+                glm::vec2 position,
+                glm::f32 layer,
+                glm::f32 rotation = 0.0f,
+                glm::i32 frameNumber = 1,
+                glm::vec4 color_override = Color::Transparent,
+                glm::vec3 scale = glm::vec3(1.0f, 1.0f, 1.0f),
+                Pivot pivot = Pivot::CENTER,
+                bool worldSpace = true
+            );
+            
+            /*
+                * Draws every slot of a retained batch this frame. Its quads are ordered with the ones drawn this frame by depth,
+                * which costs a draw call wherever the two alternate.
+                * @param batch The id of the batch
+            */
+            void draw_retained_batch(int batch);
+            
+            /*
+                * Prepares count draw streams so several threads can record draws at once, each into its own stream.
+                * The camera must not change until endDrawStreams.
+                * @param count The number of streams
+            */
+            void beginDrawStreams(size_t count);
+            
+            /*
+                * Sends the calling thread's draws to a stream until it's set back to -1. Atlas quads, text and standalone
+                * textures can be drawn into a stream, static chunks and retained batches can't.
+                * @param stream The index of the stream, -1 to draw straight into the frame
+            */
+            void setDrawStream(int stream);
+            
+            /*
+                * Appends every stream to the frame in stream order, so the result is the same however the streams were filled
+            */
+            void endDrawStreams();
+            
             /*
                 * Transforms a screen position to a world position.
                 * @param screenPos The screen position to transform
@@ -279,8 +540,22 @@ namespace Sprout
             */
             glm::vec2 windowToViewport(glm::vec2 windowPos);
 
-            int getWidth() const { return sapp_width(); }
-            int getHeight() const { return sapp_height(); }
+            /*
+                * Sets how many quads the CPU arrays and the GPU instance buffer hold before they have to grow.
+                * Submission is not capped by it, a frame with more quads grows both to fit.
+                * @param capacity The number of quads, defaults to DEFAULT_QUAD_CAPACITY
+            */
+            void setQuadCapacity(int capacity);
+            
+            /*
+                * Gets the counters of the last finished frame
+                * @return The frame stats
+            */
+            auto getFrameStats() const -> const FrameStats& { return m_frame_stats; }
+
+            // the size of the window, headless the size of the viewport
+            int getWidth() const;
+            int getHeight() const;
         private:
             static Window* Instance;
             
@@ -295,17 +570,111 @@ namespace Sprout
             UpdateFrameCallback m_update_frame_callback;
             EventCallback m_event_callback;
             
-            Atlas m_atlas;
+            TextureAtlas m_atlas;
             std::vector<std::shared_ptr<Sprout::Texture>> m_textures;
-            void bake_atlas();
             
             std::vector<std::shared_ptr<Sprout::Font>> m_fonts;
-            void init_fonts();
-            std::vector<Atlas> m_fontAtlases;
+            GlyphCache m_glyph_cache;
+            void lay_out(TextLayout& layout);
+        
+            // the camera matrices combined and inverted, rebuilt by camera_matrices when their inputs change
+            struct CameraMatrices
+            {
+                glm::mat4 view_projection = glm::mat4(0.0f);
+                glm::mat4 camera_xform = glm::mat4(0.0f);
+                glm::mat4 world_vp;
+                glm::mat4 inverse_world_vp;
+                glm::vec4 world_view;  // min x, min y, max x, max y of what the camera sees
+                glm::vec4 screen_view; // the same for screen space quads
+            };
+            CameraMatrices m_camera_matrices;
+            auto camera_matrices() -> const CameraMatrices&;
         
             std::chrono::time_point<std::chrono::system_clock> m_init_time = std::chrono::system_clock::now();
             std::chrono::time_point<std::chrono::system_clock> m_last_frame_time = std::chrono::system_clock::now();
             double m_delta_time = 0.0;
+            FrameStats m_frame_stats;
+            int m_frame_limit = 0;
+            int m_frames_run = 0;
+            
+            // sort and gather scratch, the sorted instances are what gets uploaded
+            std::vector<uint64_t> m_sort_scratch;
+            std::vector<uint64_t> m_translucent_keys;
+            std::vector<QuadInstance> m_sorted_quads;
+            
+            // the standalone textures bound while drawing the translucent quads before end
+            struct ImageSet
+            {
+                int end = 0;
+                std::array<sg_image, IMAGE_SLOTS> images;
+            };
+            std::vector<ImageSet> m_image_sets;
+            std::vector<int> m_image_slot_of; // slot of each of the frame's images in the current set, -1 if unbound
+            void bind_image_slots(DrawFrame& frame, int num_opaque);
+            
+            int m_quad_capacity = DEFAULT_QUAD_CAPACITY;
+            int m_buffer_quad_capacity = 0; // quads the instance buffer holds
+            int m_dropped_draws = 0;
+            int m_culled_draws = 0;
+            int m_submitted_draws = 0;
+            void make_instance_buffer(int quad_capacity);
+            
+            std::vector<StaticChunk> m_static_chunks; // indexed by chunk id
+            std::vector<sg_buffer> m_pending_destroys; // released chunk buffers, destroyed before the next render
+            std::vector<QuadInstance> m_static_quads; // the chunk being recorded
+            glm::vec4 m_static_bounds = glm::vec4(0.0f);
+            bool m_static_chunk_open = false;
+            
+            // what a slot was last updated with, to skip updates that change nothing
+            struct SlotInputs
+            {
+                const Sprout::Texture* texture = nullptr;
+                glm::vec2 position = glm::vec2(0.0f);
+                glm::f32 layer = 0.0f;
+                glm::f32 rotation = 0.0f;
+                glm::i32 frame = 0;
+                glm::vec4 color = glm::vec4(0.0f);
+                glm::vec3 scale = glm::vec3(0.0f);
+                Pivot pivot = Pivot::CENTER;
+                bool world_space = true;
+                
+                bool operator==(const SlotInputs& other) const = default;
+            };
+            
+            // slots by id, and the visible ones in draw order as the buffer holds them
+            struct RetainedBatch
+            {
+                std::vector<SlotInputs> inputs;
+                std::vector<QuadInstance> instances;
+                std::vector<uint8_t> visible;
+                std::vector<int> positions; // index of each slot in ordered, -1 if it isn't drawn
+                std::vector<int> free_slots;
+                std::vector<uint64_t> keys; // sort keys in draw order
+                std::vector<QuadInstance> ordered;
+                bool order_dirty = false;
+                int dirty_end = 0; // ordered is rewritten up to here since the last upload
+                
+                // sokol cycles a dynamic buffer through copies on every update, so each copy tracks what it's missing
+                sg_buffer buffer = {};
+                int capacity = 0;
+                std::array<int, SG_NUM_INFLIGHT_FRAMES> stale_end = {};
+                int next_copy = 0;
+                bool queued = false;
+            };
+            // what one thread drew between beginDrawStreams and endDrawStreams
+            struct DrawStream
+            {
+                std::vector<QuadInstance> quads;
+                std::vector<QuadInstance> standalone_quads;
+                std::vector<sg_image> images;
+                int culled_draws = 0;
+                int submitted_draws = 0;
+            };
+            std::vector<DrawStream> m_draw_streams; // kept between frames so their capacity is too
+            size_t m_num_draw_streams = 0;
+            
+            std::vector<RetainedBatch> m_retained_batches;
+            auto upload_retained_batch(RetainedBatch& batch) -> size_t;
         
             static void init_cb();
             static void frame_cb();
@@ -316,28 +685,163 @@ namespace Sprout
             void Frame();
             void Cleanup();
             void Event(const sapp_event* e);
+            void dispatch_event(const sapp_event* e);
+            
+            // a frame is simulated into draw_frame, prepared while the simulation is idle, then rendered
+            void simulate_frame(double dt);
+            void prepare_render(const DrawFrame& frame);
+            void render_frame(DrawFrame& frame);
+            
+            // what the render reads of the static chunks and retained batches, copied when the frame is prepared
+            struct RenderChunk
+            {
+                sg_buffer buffer;
+                int num_quads;
+                int num_opaque;
+            };
+            struct RenderBatch
+            {
+                std::vector<uint64_t> keys;
+                sg_buffer buffer;
+            };
+            std::vector<RenderChunk> m_render_chunks;
+            std::vector<RenderBatch> m_render_batches;
+            glm::mat4 m_render_world_vp = glm::mat4(1.0f);
+            FrameStats m_render_stats; // of the frame being rendered, published when the next one is handed off
+            double m_update_ms = 0.0;
             
+            // pipelining, the simulation thread and its handoff
+            bool m_pipelined = false;
+            DrawFrame m_render_frame;
+            std::thread m_sim_thread;
+            std::mutex m_sim_mutex;
+            std::condition_variable m_sim_wake;
+            std::condition_variable m_sim_done;
+            bool m_sim_pending = false;   // a frame was started and isn't finished
+            bool m_sim_has_frame = false; // a finished frame is waiting to be rendered
+            bool m_sim_stopping = false;
+            double m_sim_dt = 0.0;
+            std::vector<sapp_event> m_pending_events;
+            void sim_loop();
+            
+
 
+            
+            /*
+                * Tests a quad against what the camera sees, using the camera as it is when the draw is recorded, and counts it as culled or submitted.
+                * The bounds are exact for unrotated quads and a circle through the farthest corner otherwise.
+                * While a static chunk is recorded it only grows the chunk's bounds and never culls.
+                * @param position The position of the pivot
+                * @param size The size of the quad in pixels
+                * @param scale The scale of the quad
+                * @param rotation The rotation of the quad in radians
+                * @param pivot The pivot of the quad
+                * @param worldSpace Whether the quad is transformed by the camera
+                * @return False if none of the quad can be on screen
+            */
+            auto in_view(glm::vec2 position, glm::vec2 size, glm::vec2 scale, glm::f32 rotation, Pivot pivot, bool worldSpace) -> bool;
 
+            /*
+                * Moves a screen space position so the pivot also anchors it to that side of the viewport
+                * @param position The position relative to the anchor
+                * @param pivot The pivot, which is also the anchor
+                * @return The position in the viewport
+            */
+            auto anchor_position(glm::vec2 position, Pivot pivot) const -> glm::vec2;
             
-            void draw_rect_projected(
-                glm::mat4 projection, 
-                glm::vec2 size, 
+            /*
+                * Builds the instance of a sprite frame, trimmed to what the atlas holds of it
+                * @param instance Set to the instance
+                * @return False if the frame is fully transparent and there's nothing to draw
+            */
+            static auto sprite_instance(
+                Sprout::Texture& texture,
+                glm::vec2 position,
+                glm::f32 layer,
+                glm::f32 rotation,
+                glm::i32 frameNumber,
+                glm::vec4 color_override,
+                glm::vec3 scale,
+                Pivot pivot,
+                bool worldSpace,
+                QuadInstance& instance
+            ) -> bool;
+            
+            /*
+                * Finds where to put the pivot of a trimmed quad so it covers the same pixels as part of the whole frame would.
+                * @param position The position of the pivot of the whole frame
+                * @param rect x, y, width and height of the trimmed quad inside the frame
+                * @param frame_size The size of the whole frame
+                * @param scale The scale of the quad
+                * @param rotation The rotation of the quad in radians
+                * @param pivot The pivot of the quad
+                * @return The position to build the trimmed quad at
+            */
+            static auto trimmed_position(glm::vec2 position, glm::vec4 rect, glm::vec2 frame_size, glm::vec2 scale, glm::f32 rotation, Pivot pivot) -> glm::vec2;
+
+            /*
+                * Builds one quad instance, transformed on the GPU.
+                * @param position The position of the pivot, in world or screen space
+                * @param size The size of the frame in pixels
+                * @param scale The scale of the quad
+                * @param rotation The rotation of the quad in radians
+                * @param layer The depth of the quad
+                * @param uv The uvs of the (0,0) and (1,1) corners
+                * @param color_override The color override of the quad
+                * @param pivot The pivot of the quad
+                * @param img_tex_id The texture index, one of the TEXTURE_INDEX constants
+                * @param page The layer, the atlas page or the glyph cache page for TEXTURE_INDEX_ATLAS and the font indices
+                * @param worldSpace Whether the quad is transformed by the camera
+                * @return The instance
+            */
+            static auto make_instance(
+                glm::vec2 position,
+                glm::vec2 size,
+                glm::vec2 scale,
+                glm::f32 rotation,
                 glm::f32 layer,
                 glm::vec4 uv,
                 glm::vec4 color_override,
                 Pivot pivot,
-                uint8_t img_tex_id
-            );
+                uint8_t img_tex_id,
+                uint8_t page,
+                bool worldSpace
+            ) -> QuadInstance;
             
-            void draw_quad(
-                glm::mat4 projection, 
-                std::array<glm::vec4, 4> positions,
-                std::array<glm::vec4, 4> colors,
-                std::array<glm::vec2, 4> uvs,
-                std::array<glm::vec4, 4> color_overrides,
-                uint8_t img_tex_id
-            );
+            void draw_quad(const QuadInstance& instance);
+            void draw_quads(const QuadInstance* instances, int count);
+            void append_quad(const QuadInstance& instance);
+            void draw_standalone_quad(const QuadInstance& instance, sg_image image);
+            
+            /*
+                * Builds the draw order key of an instance. Sorting the keys ascending gives the draw order:
+                * depth descending in bits 48-63, texture index in bits 40-47, atlas page in bits 32-39, submission index in bits 0-31.
+                * @param instance The instance
+                * @param index The submission index of the instance
+                * @return The key
+            */
+            static auto make_sort_key(const QuadInstance& instance, uint32_t index) -> uint64_t;
+            
+            /*
+                * Stable LSD radix sort of draw keys on their upper 32 bits, 8 bits per pass.
+                * Passes where every key has the same digit are skipped.
+                * @param keys The keys, in submission order
+                * @param scratch Scratch space for at least count keys
+                * @param count The number of keys
+                * @return The sorted keys, either keys or scratch
+            */
+            static auto radix_sort_keys(uint64_t* keys, uint64_t* scratch, int count) -> const uint64_t*;
+            
+            /*
+                * Gathers quads for the two passes, the opaque ones front to back followed by the rest in key order
+                * @param keys The sorted keys of the quads
+                * @param count The number of keys
+                * @param quads The quads, indexed by the submission index of the keys
+                * @param gathered Filled with count quads
+                * @param translucent_keys Filled with the keys of the quads after the opaque ones, can be null
+                * @return The number of opaque quads
+            */
+            static auto gather_passes(const uint64_t* keys, int count, const QuadInstance* quads, QuadInstance* gathered, uint64_t* translucent_keys) -> int;
             
     };
         
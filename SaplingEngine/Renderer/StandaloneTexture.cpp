@@ -151,7 +151,11 @@ namespace Sprout
     {
         if (m_isLoaded && m_image.id != SG_INVALID_ID)
         {
-            sg_destroy_image(m_image);
+            // after the window shut sokol down its images are already gone
+            if (sg_isvalid())
+            {
+                sg_destroy_image(m_image);
+            }
             m_image.id = SG_INVALID_ID;
             m_isLoaded = false;
         }
@@ -5,12 +5,15 @@
 
 
 #include "Renderer/Texture.hpp"
+#include "Renderer/AtlasFormat.hpp"
 #include "Renderer/Sprout.hpp"
 
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb/stb_image.h"
 
+#include <cstdlib>
+
 
 namespace Sprout
 {
@@ -20,7 +23,7 @@ namespace Sprout
     bool Texture::loadFromFile(const std::string& path, const glm::i32 numFrames) 
     {
         int width, height, channels;
-        unsigned char* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+        unsigned char* data = stbi_load(path.c_str(), &width, &height, &channels, 4);
         if (!data)
         {
             return false;
@@ -29,6 +32,8 @@ namespace Sprout
         m_pixels = data;
         m_width = width;
         m_height = height;
+        m_trim = glm::vec4(0.0f, 0.0f, width, height);
+        m_opaque = !has_partial_alpha(data, width, width, height);
         
         m_numFrames = numFrames;
         m_frameHeight = m_height;
@@ -40,7 +45,7 @@ namespace Sprout
     
     void Texture::registerTexture()
     {
-        Window::getInstance()->addTexture(std::shared_ptr<Texture>(this));
+        Window::getInstance()->addTexture(shared_from_this());
     }
     
     glm::vec2 Texture::getSize()
@@ -68,6 +73,45 @@ namespace Sprout
         m_atlas_uvs = uvs;
     }
     
+    glm::vec4 Texture::getTrim()
+    {
+        return m_trim;
+    }
+    
+    void Texture::setTrim(glm::vec4 trim)
+    {
+        m_trim = trim;
+    }
+    
+    bool Texture::getPackedRegion(const glm::vec4 region, glm::vec4& rect, glm::vec4& uvs)
+    {
+        // intersect the region with the trim rect, then map that into the uvs of the trim rect
+        glm::vec2 min = glm::max(glm::vec2(region.x, region.y), glm::vec2(m_trim.x, m_trim.y));
+        glm::vec2 max = glm::min(glm::vec2(region.x + region.z, region.y + region.w), glm::vec2(m_trim.x + m_trim.z, m_trim.y + m_trim.w));
+        if (max.x <= min.x || max.y <= min.y)
+        {
+            return false;
+        }
+        
+        glm::vec2 uv_min = glm::vec2(m_atlas_uvs.x, m_atlas_uvs.y);
+        glm::vec2 uv_per_pixel = glm::vec2(m_atlas_uvs.z - m_atlas_uvs.x, m_atlas_uvs.w - m_atlas_uvs.y) / glm::vec2(m_trim.z, m_trim.w);
+        glm::vec2 trim_pos = glm::vec2(m_trim.x, m_trim.y);
+        
+        rect = glm::vec4(min - glm::vec2(region.x, region.y), max - min);
+        uvs = glm::vec4(uv_min + (min - trim_pos) * uv_per_pixel, uv_min + (max - trim_pos) * uv_per_pixel);
+        return true;
+    }
+    
+    glm::i32 Texture::getAtlasPage()
+    {
+        return m_atlas_page;
+    }
+    
+    void Texture::setAtlasPage(glm::i32 page)
+    {
+        m_atlas_page = page;
+    }
+    
     glm::vec2 Texture::getFrameSize()
     {
         return glm::vec2(m_frameWidth, m_frameHeight);
@@ -85,11 +129,14 @@ namespace Sprout
     
     bool Texture::loadFromMemory(unsigned char* data, const glm::i32 width, const glm::i32 height, const glm::i32 numFrames)
     {
-        m_pixels = new unsigned char[width * height * 4];
+        // malloc like stbi_load, release frees either
+        m_pixels = static_cast<unsigned char*>(std::malloc(width * height * 4));
         std::memcpy(m_pixels, data, width * height * 4);
         
         m_width = width;
         m_height = height;
+        m_trim = glm::vec4(0.0f, 0.0f, width, height);
+        m_opaque = !has_partial_alpha(m_pixels, width, width, height);
 
         m_numFrames = numFrames;
         m_frameHeight = height;
@@ -98,6 +145,20 @@ namespace Sprout
         return true;
     }
     
+    void Texture::loadFromAtlas(const glm::i32 width, const glm::i32 height, const glm::vec4 uvs, const glm::vec4 trim, const glm::i32 page, const glm::i32 numFrames)
+    {
+        m_pixels = nullptr;
+        m_width = width;
+        m_height = height;
+        m_atlas_uvs = uvs;
+        m_trim = trim;
+        m_atlas_page = page;
+
+        m_numFrames = numFrames;
+        m_frameHeight = m_height;
+        m_frameWidth = m_width / m_numFrames;
+    }
+    
     std::vector<std::shared_ptr<Texture>> Texture::loadTileset(const std::string& path, const size_t tileWidth, const size_t tileHeight)
     {
         int width, height, channels;
@@ -142,6 +203,7 @@ namespace Sprout
     void Texture::release()
     {
         free(m_pixels);
+        m_pixels = nullptr;
     }
 
 } // namespace Sprout
\ No newline at end of file
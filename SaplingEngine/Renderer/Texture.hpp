@@ -15,7 +15,7 @@
 namespace Sprout
 {
     
-    class Texture
+    class Texture : public std::enable_shared_from_this<Texture>
     {
         public:
             Texture() = default;
@@ -66,6 +66,52 @@ namespace Sprout
             */
             auto setAtlasUVs(glm::vec4 uvs) -> void;
             
+            /*
+                * Gets the part of the texture that is in the atlas, what is left after trimming its transparent margins
+                * @return x, y, width and height in pixels, the width is 0 if the whole texture was transparent
+            */
+            auto getTrim() -> glm::vec4;
+            
+            /*
+                * Sets the part of the texture that is in the atlas
+                * @param trim x, y, width and height in pixels
+            */
+            auto setTrim(glm::vec4 trim) -> void;
+            
+            /*
+                * Finds what of a region of the texture, like an animation frame, made it into the atlas
+                * @param region x, y, width and height of the region in pixels
+                * @param rect Filled with x, y, width and height of the packed part, relative to the region
+                * @param uvs Filled with the UV coordinates of the packed part
+                * @return False if trimming removed the whole region
+            */
+            auto getPackedRegion(glm::vec4 region, glm::vec4& rect, glm::vec4& uvs) -> bool;
+            
+            /*
+                * Gets the atlas page the texture was packed into
+                * @return The page index
+            */
+            auto getAtlasPage() -> glm::i32;
+            
+            /*
+                * Sets the atlas page the texture was packed into
+                * @param page The page index
+            */
+            auto setAtlasPage(glm::i32 page) -> void;
+            
+            /*
+                * Checks if every pixel of the texture is fully opaque or fully transparent.
+                * Such textures are drawn in the depth tested opaque pass, with the transparent pixels discarded.
+                * @return True if nothing in the texture needs blending
+            */
+            auto isOpaque() const -> bool { return m_opaque; }
+            
+            /*
+                * Sets if the texture needs blending, for textures that are already in the atlas and have no pixels to check
+                * @param opaque True if every pixel is fully opaque or fully transparent
+            */
+            auto setOpaque(bool opaque) -> void { m_opaque = opaque; }
+            
             /*
                 * Gets the size of a frame in the texture
                 * @return The size of a frame in the texture
@@ -79,7 +125,7 @@ namespace Sprout
             auto getNumFrames() -> glm::i32;
             
             /*
-                * Registers the texture with the renderer (adds it to the atlas)
+                * Registers the texture with the renderer (adds it to the atlas), the texture must be owned by a shared_ptr
             */
             auto registerTexture() -> void;
             
@@ -102,12 +148,26 @@ namespace Sprout
             */
             auto loadFromMemory(unsigned char* data, glm::i32 width, glm::i32 height, glm::i32 numFrames = 1) -> bool;
             
+            /*
+                * Sets up a texture that is already in the atlas, it has no pixel data and isn't packed again
+                * @param width The width of the texture
+                * @param height The height of the texture
+                * @param uvs The UV coordinates of the packed part of the texture in the atlas
+                * @param trim x, y, width and height of the packed part in pixels
+                * @param page The atlas page of the texture
+                * @param numFrames The number of frames in the texture (if animated)
+            */
+            auto loadFromAtlas(glm::i32 width, glm::i32 height, glm::vec4 uvs, glm::vec4 trim, glm::i32 page, glm::i32 numFrames = 1) -> void;
+            
             void release();
             
         private:
             glm::i32 m_width, m_height;
             glm::vec4 m_atlas_uvs = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
-            unsigned char* m_pixels;
+            glm::i32 m_atlas_page = 0;
+            glm::vec4 m_trim = glm::vec4(0.0f);
+            unsigned char* m_pixels = nullptr;
+            bool m_opaque = false;
             
             // animated sprites data
             glm::i32 m_frameWidth, m_frameHeight, m_numFrames;
@@ -0,0 +1,303 @@
+//
+//  TextureAtlas.cpp
+//  Sapling Engine, Sprout Renderer
+//
+
+#include "Renderer/TextureAtlas.hpp"
+
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "stb/stb_rect_pack.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Sprout
+{
+
+    TextureAtlas::TextureAtlas(int pageSize, int maxPages)
+        :   m_pageSize(pageSize),
+            m_maxPages(maxPages)
+    {
+    }
+
+    TextureAtlas::~TextureAtlas()
+    {
+        if (m_image.id != SG_INVALID_ID && sg_isvalid())
+        {
+            sg_destroy_image(m_image);
+        }
+    }
+
+    auto TextureAtlas::add(const std::shared_ptr<Texture>& texture) -> bool
+    {
+        AtlasTrim trim = { 0, 0, texture->getWidth(), texture->getHeight() };
+        if (m_trimming)
+        {
+            trim = trim_transparent(texture->getPixels(), texture->getWidth(), texture->getHeight());
+        }
+        texture->setTrim(glm::vec4(trim.x, trim.y, trim.width, trim.height));
+
+        // nothing to draw, so nothing to pack
+        if (trim.width == 0)
+        {
+            return true;
+        }
+        if (trim.width + (ATLAS_PADDING * 2) > m_pageSize || trim.height + (ATLAS_PADDING * 2) > m_pageSize)
+        {
+            return false;
+        }
+
+        m_pending.push_back(texture);
+        return true;
+    }
+
+    auto TextureAtlas::pack() -> bool
+    {
+        if (m_pending.empty())
+        {
+            return true;
+        }
+
+        std::vector<stbrp_rect> rects(m_pending.size());
+        for (size_t i = 0; i < m_pending.size(); i++)
+        {
+            glm::vec4 trim = m_pending[i]->getTrim();
+            rects[i].id = static_cast<int>(i);
+            rects[i].w = static_cast<int>(trim.z) + (ATLAS_PADDING * 2);
+            rects[i].h = static_cast<int>(trim.w) + (ATLAS_PADDING * 2);
+            rects[i].was_packed = 0;
+        }
+
+        // fill the pages in order, the skyline packer keeps its state so earlier pages take what still fits
+        std::vector<stbrp_rect> remaining;
+        for (size_t page = 0; !rects.empty(); page++)
+        {
+            if (page == m_pages.size())
+            {
+                if (getPageCount() >= m_maxPages)
+                {
+                    break;
+                }
+                openPage();
+            }
+            stbrp_pack_rects(&m_pages[page]->context, rects.data(), static_cast<int>(rects.size()));
+
+            remaining.clear();
+            for (const stbrp_rect& rect : rects)
+            {
+                if (!rect.was_packed)
+                {
+                    remaining.push_back(rect);
+                    continue;
+                }
+
+                Texture& texture = *m_pending[rect.id];
+                glm::vec4 trim = texture.getTrim();
+                const int x = rect.x + ATLAS_PADDING;
+                const int y = rect.y + ATLAS_PADDING;
+                const unsigned char* pixels = texture.getPixels() + (static_cast<size_t>(trim.y) * texture.getWidth() + static_cast<size_t>(trim.x)) * 4;
+                blit_padded(
+                    m_pixels.data() + page * m_pageSize * m_pageSize * 4,
+                    m_pageSize,
+                    pixels,
+                    texture.getWidth(),
+                    static_cast<int>(trim.z),
+                    static_cast<int>(trim.w),
+                    x,
+                    y
+                );
+
+                texture.setAtlasUVs(glm::vec4(
+                    (float)x / m_pageSize,
+                    (float)y / m_pageSize,
+                    (float)(x + trim.z) / m_pageSize,
+                    (float)(y + trim.w) / m_pageSize
+                ));
+                texture.setAtlasPage(m_bakedPages + static_cast<int>(page));
+                m_dirty = true;
+            }
+            rects.swap(remaining);
+        }
+
+        // whatever the pages couldn't take stays queued
+        std::vector<std::shared_ptr<Texture>> unpacked;
+        for (const stbrp_rect& rect : rects)
+        {
+            unpacked.push_back(m_pending[rect.id]);
+        }
+        m_pending.swap(unpacked);
+        return m_pending.empty();
+    }
+
+    auto TextureAtlas::upload() -> bool
+    {
+        // the image always needs a layer to be bindable
+        if (getPageCount() == 0)
+        {
+            openPage();
+            m_dirty = true;
+        }
+        if (!m_dirty)
+        {
+            return false;
+        }
+
+        if (m_imagePages != getPageCount())
+        {
+            if (m_image.id != SG_INVALID_ID)
+            {
+                sg_destroy_image(m_image);
+            }
+
+            sg_image_desc img_desc = {};
+            img_desc.type = SG_IMAGETYPE_ARRAY;
+            img_desc.width = m_pageSize;
+            img_desc.height = m_pageSize;
+            img_desc.num_slices = getPageCount();
+            img_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
+            img_desc.usage = SG_USAGE_DYNAMIC;
+            img_desc.label = "atlas-pages";
+
+            m_image = sg_make_image(&img_desc);
+            m_imagePages = getPageCount();
+        }
+
+        // array layers are uploaded together, so every page goes up even if only one changed
+        const size_t baked_size = static_cast<size_t>(m_bakedPages) * m_pageSize * m_pageSize * 4;
+        std::vector<unsigned char> staging;
+        sg_image_data data = {};
+        if (m_pages.empty())
+        {
+            data.subimage[0][0].ptr = getPagePixels(0);
+            data.subimage[0][0].size = baked_size;
+        }
+        else if (m_bakedPages == 0)
+        {
+            data.subimage[0][0].ptr = m_pixels.data();
+            data.subimage[0][0].size = m_pixels.size();
+        }
+        else
+        {
+            // packed pages follow the baked ones, which live in the mapping, so the layers have to be joined
+            staging.reserve(baked_size + m_pixels.size());
+            staging.insert(staging.end(), getPagePixels(0), getPagePixels(0) + baked_size);
+            staging.insert(staging.end(), m_pixels.begin(), m_pixels.end());
+            data.subimage[0][0].ptr = staging.data();
+            data.subimage[0][0].size = staging.size();
+        }
+        sg_update_image(m_image, &data);
+
+        m_dirty = false;
+        return true;
+    }
+
+    auto TextureAtlas::loadBaked(const std::string& path) -> bool
+    {
+        if (!m_pages.empty() || !m_pending.empty() || m_bakedPages > 0)
+        {
+            return false;
+        }
+        if (!m_baked.open(path))
+        {
+            return false;
+        }
+
+        // check everything the header points at is inside the file before trusting it
+        const size_t file_size = m_baked.size();
+        BakedAtlasHeader header;
+        bool valid = file_size >= sizeof(header);
+        if (valid)
+        {
+            memcpy(&header, m_baked.data(), sizeof(header));
+            const size_t entries_end = sizeof(header) + static_cast<size_t>(header.entry_count) * sizeof(BakedAtlasEntry);
+            const size_t pixels_size = static_cast<size_t>(header.page_count) * header.page_size * header.page_size * 4;
+            valid = header.magic == BAKED_ATLAS_MAGIC
+                && header.version == BAKED_ATLAS_VERSION
+                && header.page_size > 0
+                && static_cast<int>(header.page_count) <= m_maxPages
+                && entries_end <= header.names_offset
+                && header.names_offset <= file_size
+                && header.pixels_offset % 4 == 0
+                && header.pixels_offset <= file_size
+                && pixels_size <= file_size - header.pixels_offset;
+        }
+        for (uint32_t i = 0; valid && i < header.entry_count; i++)
+        {
+            BakedAtlasEntry entry;
+            memcpy(&entry, m_baked.data() + sizeof(header) + i * sizeof(BakedAtlasEntry), sizeof(entry));
+            valid = static_cast<size_t>(entry.name_offset) + entry.name_length <= file_size - header.names_offset
+                && (entry.width == 0 || entry.page < header.page_count)
+                && static_cast<uint32_t>(entry.x) + entry.width <= header.page_size
+                && static_cast<uint32_t>(entry.y) + entry.height <= header.page_size
+                && static_cast<uint32_t>(entry.trim_x) + entry.width <= entry.source_width
+                && static_cast<uint32_t>(entry.trim_y) + entry.height <= entry.source_height;
+        }
+        if (!valid)
+        {
+            m_baked.close();
+            return false;
+        }
+
+        m_pageSize = static_cast<int>(header.page_size);
+        m_bakedPages = static_cast<int>(header.page_count);
+        m_bakedEntries = reinterpret_cast<const BakedAtlasEntry*>(m_baked.data() + sizeof(header));
+        m_bakedEntryCount = static_cast<int>(header.entry_count);
+        m_dirty = true;
+        return true;
+    }
+
+    auto TextureAtlas::findBaked(const std::string& name, BakedRegion& region) const -> bool
+    {
+        // the baker sorts the entries by name
+        const BakedAtlasEntry* end = m_bakedEntries + m_bakedEntryCount;
+        const BakedAtlasEntry* it = std::lower_bound(m_bakedEntries, end, std::string_view(name),
+            [this](const BakedAtlasEntry& entry, std::string_view key) { return bakedName(entry) < key; });
+        if (it == end || bakedName(*it) != name)
+        {
+            return false;
+        }
+
+        region.uvs = glm::vec4(
+            (float)it->x / m_pageSize,
+            (float)it->y / m_pageSize,
+            (float)(it->x + it->width) / m_pageSize,
+            (float)(it->y + it->height) / m_pageSize
+        );
+        region.trim = glm::vec4(it->trim_x, it->trim_y, it->width, it->height);
+        region.page = it->page;
+        region.width = it->source_width;
+        region.height = it->source_height;
+        return true;
+    }
+
+    auto TextureAtlas::getPagePixels(int page) const -> const unsigned char*
+    {
+        const size_t page_bytes = static_cast<size_t>(m_pageSize) * m_pageSize * 4;
+        if (page < m_bakedPages)
+        {
+            const BakedAtlasHeader* header = reinterpret_cast<const BakedAtlasHeader*>(m_baked.data());
+            return m_baked.data() + header->pixels_offset + page * page_bytes;
+        }
+        return m_pixels.data() + (page - m_bakedPages) * page_bytes;
+    }
+
+    auto TextureAtlas::openPage() -> Page&
+    {
+        auto page = std::make_unique<Page>();
+        page->nodes.resize(m_pageSize);
+        stbrp_init_target(&page->context, m_pageSize, m_pageSize, page->nodes.data(), m_pageSize);
+        stbrp_setup_heuristic(&page->context, STBRP_HEURISTIC_Skyline_BF_sortHeight);
+
+        m_pages.push_back(std::move(page));
+        m_pixels.resize(m_pages.size() * m_pageSize * m_pageSize * 4, 0);
+        return *m_pages.back();
+    }
+
+    auto TextureAtlas::bakedName(const BakedAtlasEntry& entry) const -> std::string_view
+    {
+        const BakedAtlasHeader* header = reinterpret_cast<const BakedAtlasHeader*>(m_baked.data());
+        const char* names = reinterpret_cast<const char*>(m_baked.data() + header->names_offset);
+        return std::string_view(names + entry.name_offset, entry.name_length);
+    }
+
+}
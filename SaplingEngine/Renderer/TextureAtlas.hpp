@@ -0,0 +1,142 @@
+//
+//  TextureAtlas.hpp
+//  Sapling Engine, Sprout Renderer
+//
+
+#pragma once
+
+#include "Renderer/AtlasFormat.hpp"
+#include "Renderer/Texture.hpp"
+#include "Utility/MappedFile.hpp"
+
+#include "glm/glm.hpp"
+#include "stb/stb_rect_pack.h"
+#include "sokol/sokol_gfx.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Sprout
+{
+
+    /*
+        * Texture atlas split over the layers of a 2D array image.
+        * Added textures are trimmed of their transparent margins and queued, then pack places the whole queue at once,
+        * letting the packer sort it by height, filling the pages in order and opening new ones for what is left.
+        * Every page is kept on the CPU: sokol images can't be partially updated, so pages packed into since the last
+        * upload are sent as a whole, and the image is recreated with more layers when a page is opened.
+        * A baked atlas can be loaded first, its pages become the first layers and are uploaded straight from the mapped file.
+    */
+    class TextureAtlas
+    {
+        public:
+            /*
+                * Creates an empty atlas, no GPU work is done until upload.
+                * @param pageSize The width and height of a page in pixels
+                * @param maxPages The number of pages after which add fails
+            */
+            TextureAtlas(int pageSize = 1024, int maxPages = 16);
+            ~TextureAtlas();
+
+            TextureAtlas(const TextureAtlas&) = delete;
+            TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+            // where a texture sits in the baked atlas
+            struct BakedRegion
+            {
+                glm::vec4 uvs;
+                glm::vec4 trim; // x, y, width and height of the packed pixels in the texture
+                glm::i32 page;
+                glm::i32 width, height;
+            };
+
+            /*
+                * Maps a file written by AtlasBaker, its pages are never packed into.
+                * Only works before anything is added, and takes the page size of the file.
+                * @param path The path to the baked atlas
+                * @return False if nothing was added, the file is missing or it isn't a baked atlas
+            */
+            auto loadBaked(const std::string& path) -> bool;
+
+            /*
+                * Looks up a texture in the baked atlas
+                * @param name The path of the texture relative to the assets directory, with forward slashes
+                * @param region Filled in if the texture was baked
+                * @return True if the texture was baked
+            */
+            auto findBaked(const std::string& name, BakedRegion& region) const -> bool;
+
+            /*
+                * Trims a texture and queues it for the next pack. Works before sokol is set up.
+                * @param texture The texture to pack
+                * @return False if the texture doesn't fit in a page
+            */
+            auto add(const std::shared_ptr<Texture>& texture) -> bool;
+
+            /*
+                * Packs every queued texture in one go and sets their uvs and page.
+                * @return False if the pages ran out, what didn't fit stays queued
+            */
+            auto pack() -> bool;
+
+            /*
+                * Sets whether transparent margins are cut off textures added after this, on by default
+                * @param trim Whether to trim
+            */
+            void setTrimming(bool trim) { m_trimming = trim; }
+
+            /*
+                * Sends the pages packed into since the last call to the GPU, creating the image on first use.
+                * Only call it after sg_setup and at most once per frame.
+                * @return True if anything was uploaded
+            */
+            auto upload() -> bool;
+
+            /*
+                * Gets the array image holding the pages, only valid after upload
+                * @return The image
+            */
+            auto getImage() const -> sg_image { return m_image; }
+
+            auto getPageCount() const -> int { return m_bakedPages + static_cast<int>(m_pages.size()); }
+            auto getPageSize() const -> int { return m_pageSize; }
+
+            /*
+                * Gets the RGBA pixels of a page
+                * @param page The page index
+                * @return The pixels, pageSize * pageSize * 4 bytes
+            */
+            auto getPagePixels(int page) const -> const unsigned char*;
+
+        private:
+            // packer state of one page, heap allocated because stbrp_context points into nodes
+            struct Page
+            {
+                stbrp_context context;
+                std::vector<stbrp_node> nodes;
+            };
+
+            int m_pageSize;
+            int m_maxPages;
+            std::vector<std::unique_ptr<Page>> m_pages;
+            std::vector<unsigned char> m_pixels; // every packed page back to back
+            std::vector<std::shared_ptr<Texture>> m_pending;
+            bool m_trimming = true;
+
+            MappedFile m_baked;
+            const BakedAtlasEntry* m_bakedEntries = nullptr;
+            int m_bakedEntryCount = 0;
+            int m_bakedPages = 0; // layers before the packed pages
+
+            sg_image m_image = {};
+            int m_imagePages = 0; // layers of m_image
+            bool m_dirty = false;
+
+            auto openPage() -> Page&;
+            auto bakedName(const BakedAtlasEntry& entry) const -> std::string_view;
+    };
+
+}
@@ -7,6 +7,7 @@
 //  related to windowing but not part of sokol implementation.
 //  For the sokol window setup, see Sprout.mm
 
+#include "Core/JobSystem.hpp"
 #include "Renderer/Font.hpp"
 #include "Renderer/Sprout.hpp"
 #include "Renderer/quad.h"
@@ -15,13 +16,17 @@
 
 #include "glm/fwd.hpp"
 #include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtc/packing.hpp"
+#include "glm/gtc/constants.hpp"
 
+#include <cassert>
+#include <cmath>
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
-
-#define STB_RECT_PACK_IMPLEMENTATION
-#include "stb/stb_rect_pack.h"
+#include <utility>
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "stb/stb_image_write.h"
@@ -29,207 +34,24 @@
 namespace Sprout
 {
 
-    void Window::bake_atlas()
-    {
-        const int PADDING = 2;
-            m_atlas.width = 1024;
-            m_atlas.height = 1024;
-            
-            unsigned char* atlas_data = (unsigned char*)malloc(m_atlas.width * m_atlas.height * 4);
-            memset((void*)atlas_data, 0, m_atlas.width * m_atlas.height * 4);
-            
-            stbrp_context context;
-            stbrp_node* nodes = (stbrp_node*)malloc(sizeof(stbrp_node) * m_atlas.width);
-            stbrp_init_target(&context, m_atlas.width, m_atlas.height, nodes, m_atlas.width);
-            
-            for (auto& tex : m_textures) {
-                stbrp_rect rect;
-                rect.id = 0;
-                rect.w = tex->getWidth() + (PADDING * 2);
-                rect.h = tex->getHeight() + (PADDING * 2);
-                
-                if (!stbrp_pack_rects(&context, &rect, 1)) {
-                    throw std::runtime_error("Failed to pack rects");
-                    continue;
-                }
-                
-                // copy texture data
-                for (int y = 0; y < tex->getHeight(); y++) {
-                    for (int x = 0; x < tex->getWidth(); x++) {
-                        int src_index = (y * tex->getWidth() + x) * 4;
-                        int dst_index = ((rect.y + PADDING + y) * m_atlas.width + (rect.x + PADDING + x)) * 4;
-                        
-                        atlas_data[dst_index + 0] = tex->getPixels()[src_index + 0];
-                        atlas_data[dst_index + 1] = tex->getPixels()[src_index + 1];
-                        atlas_data[dst_index + 2] = tex->getPixels()[src_index + 2];
-                        atlas_data[dst_index + 3] = tex->getPixels()[src_index + 3];
-                    }
-                }
-                
-                // extend edges into padding
-                int base_x = rect.x + PADDING;
-                int base_y = rect.y + PADDING;
-                int width = tex->getWidth();
-                int height = tex->getHeight();
-                
-                // horizontal edges
-                for (int x = 0; x < width; x++) {
-                    // T
-                    for (int p = 1; p <= PADDING; p++) {
-                        int src_index = ((base_y) * m_atlas.width + (base_x + x)) * 4;
-                        int dst_index = ((base_y - p) * m_atlas.width + (base_x + x)) * 4;
-                        memcpy(&atlas_data[dst_index], &atlas_data[src_index], 4);
-                    }
-                    
-                    // B
-                    for (int p = 1; p <= PADDING; p++) {
-                        int src_index = ((base_y + height - 1) * m_atlas.width + (base_x + x)) * 4;
-                        int dst_index = ((base_y + height - 1 + p) * m_atlas.width + (base_x + x)) * 4;
-                        memcpy(&atlas_data[dst_index], &atlas_data[src_index], 4);
-                    }
-                }
-                
-                // vertical edges
-                for (int y = 0; y < height; y++) {
-                    // L
-                    for (int p = 1; p <= PADDING; p++) {
-                        int src_index = ((base_y + y) * m_atlas.width + base_x) * 4;
-                        int dst_index = ((base_y + y) * m_atlas.width + (base_x - p)) * 4;
-                        memcpy(&atlas_data[dst_index], &atlas_data[src_index], 4);
-                    }
-                    
-                    // R
-                    for (int p = 1; p <= PADDING; p++) {
-                        int src_index = ((base_y + y) * m_atlas.width + (base_x + width - 1)) * 4;
-                        int dst_index = ((base_y + y) * m_atlas.width + (base_x + width - 1 + p)) * 4;
-                        memcpy(&atlas_data[dst_index], &atlas_data[src_index], 4);
-                    }
-                }
-                
-                // corners
-                for (int py = 1; py <= PADDING; py++) {
-                    for (int px = 1; px <= PADDING; px++) {
-                        // TL
-                        memcpy(
-                            &atlas_data[((base_y - py) * m_atlas.width + (base_x - px)) * 4],
-                            &atlas_data[(base_y * m_atlas.width + base_x) * 4],
-                            4
-                        );
-                        
-                        // TR
-                        memcpy(
-                            &atlas_data[((base_y - py) * m_atlas.width + (base_x + width - 1 + px)) * 4],
-                            &atlas_data[(base_y * m_atlas.width + (base_x + width - 1)) * 4],
-                            4
-                        );
-                        
-                        // BL
-                        memcpy(
-                            &atlas_data[((base_y + height - 1 + py) * m_atlas.width + (base_x - px)) * 4],
-                            &atlas_data[((base_y + height - 1) * m_atlas.width + base_x) * 4],
-                            4
-                        );
-                        
-                        // BR
-                        memcpy(
-                            &atlas_data[((base_y + height - 1 + py) * m_atlas.width + (base_x + width - 1 + px)) * 4],
-                            &atlas_data[((base_y + height - 1) * m_atlas.width + (base_x + width - 1)) * 4],
-                            4
-                        );
-                    }
-                }
-                
-                glm::vec4 uv = glm::vec4(
-                    (float)(rect.x + PADDING) / m_atlas.width,
-                    (float)(rect.y + PADDING) / m_atlas.height,
-                    (float)(rect.x + PADDING + tex->getWidth()) / m_atlas.width,
-                    (float)(rect.y + PADDING + tex->getHeight()) / m_atlas.height
-                );
-                tex->setAtlasUVs(uv);
-            }
-            
-            sg_image_desc img_desc = {};
-            img_desc.width = m_atlas.width;
-            img_desc.height = m_atlas.height;
-            img_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
-            img_desc.data.subimage[0][0].ptr = atlas_data;
-            img_desc.data.subimage[0][0].size = (size_t)m_atlas.width * m_atlas.height * 4;
- 
-            
-            m_atlas.img = sg_make_image(&img_desc);
-            
-            #ifdef DEBUG
-            stbi_write_png("atlas.png", m_atlas.width, m_atlas.height, 4, atlas_data, m_atlas.width * 4);
-            #endif
-            
-            free(atlas_data);
-            free(nodes);
-    }
-    
+    // the draw stream of the calling thread, see Window::setDrawStream
+    static thread_local int t_draw_stream = -1;
+
     void Window::addTexture(const std::shared_ptr<Texture> tex)
     {
         m_textures.push_back(tex);
-    }
-    
-    void Window::init_fonts()
-    {
-        int atlas_width = 512;
-        int atlas_height = 512;
-
-        for (size_t i = 0; i < m_fonts.size(); i++)
+        
+        // textures added before Init are packed together there, later ones right away so they can be drawn this frame
+        if (!m_atlas.add(tex) || (sg_isvalid() && !m_atlas.pack()))
         {
-            float font_size = m_fonts[i]->size;
-            unsigned char* atlas_data = new unsigned char[atlas_width * atlas_height];
-            memset(atlas_data, 0, atlas_width * atlas_height);
-
-            stbtt_BakeFontBitmap(
-                m_fonts[i]->data,           // unsigned char* font data
-                0,                          // font offset
-                font_size,                  // pixel height
-                atlas_data,                 // output bitmap
-                atlas_width,                // output bitmap width
-                atlas_height,               // output bitmap height
-                32,                         // first character (space)
-                96,                         // number of characters
-                m_fonts[i]->bakedChars      // output character data
-            );
-
-            std::vector<unsigned char> rgba_data(atlas_width * atlas_height * 4, 0);
-            for (int j = 0; j < atlas_width * atlas_height; j++) {
-                unsigned char alpha = atlas_data[j];
-                rgba_data[j * 4 + 0] = 255;  // R
-                rgba_data[j * 4 + 1] = 255;  // G
-                rgba_data[j * 4 + 2] = 255;  // B
-                rgba_data[j * 4 + 3] = alpha;  // A
-            }
-
-            sg_image_desc img_desc = {};
-            img_desc.width = atlas_width;
-            img_desc.height = atlas_height;
-            img_desc.pixel_format = SG_PIXELFORMAT_RGBA8;
-            img_desc.data.subimage[0][0].ptr = rgba_data.data();
-            img_desc.data.subimage[0][0].size = rgba_data.size();
-
-            Atlas fontAtlas;
-            fontAtlas.img = sg_make_image(&img_desc);
-            fontAtlas.width = atlas_width;
-            fontAtlas.height = atlas_height;
-            
-            m_fontAtlases.push_back(fontAtlas);
-            
-            m_fonts[i]->fontId = i;
-            
-            #ifdef DEBUG
-            std::string filename = "fontAtlas" + std::to_string(i) + ".png";
-            stbi_write_png(filename.c_str(), atlas_width, atlas_height, 1, atlas_data, atlas_width);
-            #endif
-            
-            delete[] atlas_data;
+            throw std::runtime_error("Failed to pack rects");
         }
     }
     
     void Window::addFont(const std::shared_ptr<Font> font)
     {
+        // the id keys the font's glyphs in the glyph cache
+        font->fontId = static_cast<uint8_t>(m_fonts.size());
         m_fonts.push_back(font);
     }
     
@@ -259,59 +81,66 @@ namespace Sprout
         const Pivot pivot,
         const bool worldSpace)
     {   
-        glm::mat4 xform0 = glm::mat4(1.0f);
-        
-
-        // translate
-        if (worldSpace)
+        const glm::vec2 pos = worldSpace ? position : anchor_position(position, pivot);
+        if (!in_view(pos, texture->getFrameSize(), glm::vec2(scale), rotation, pivot, worldSpace))
         {
-            xform0 = glm::translate(xform0, glm::vec3(position, 0.0f));     
+            return;
         }
-        else // ui elements need to use pivot for an anchor as well as a pivot
+        
+        // draw, the shader applies scale then rotation around the pivot and picks the camera or screen matrix
+        QuadInstance instance;
+        if (sprite_instance(*texture, pos, layer, rotation, frameNum, color_override, scale, pivot, worldSpace, instance))
         {
-            glm::vec2 anchor_offset = getAnchorOffset(pivot);
-            glm::vec2 pos = glm::vec2(position.x * anchor_offset.x * -1, position.y * anchor_offset.y * -1);
-            if (anchor_offset.x == 0)       pos.x = position.x;
-            if (anchor_offset.y == 0)       pos.y = -position.y;
-            
-            anchor_offset.x = anchor_offset.x * m_viewportWidth + pos.x;
-            anchor_offset.y = anchor_offset.y * m_viewportHeight + pos.y;
-            
-            xform0 = glm::translate(xform0, glm::vec3(anchor_offset, 0.0f));       
+            draw_quad(instance);
         }
+    }
+    
+    auto Window::anchor_position(const glm::vec2 position, const Pivot pivot) const -> glm::vec2
+    {
+        // ui elements need to use pivot for an anchor as well as a pivot
+        glm::vec2 anchor_offset = getAnchorOffset(pivot);
+        glm::vec2 pos = glm::vec2(position.x * anchor_offset.x * -1, position.y * anchor_offset.y * -1);
+        if (anchor_offset.x == 0)       pos.x = position.x;
+        if (anchor_offset.y == 0)       pos.y = -position.y;
         
-        // scale
-        xform0 = glm::scale(xform0, scale);
-        
-        // rotate
-        xform0 = glm::rotate(xform0, rotation, glm::vec3(0.0f, 0.0f, 1.0f));
-        
-        glm::vec2 size = texture->getSize();                
-        glm::vec2 frame_size = texture->getFrameSize();
-        glm::vec4 uv = texture->getAtlasUVs();
+        pos.x += anchor_offset.x * m_viewportWidth;
+        pos.y += anchor_offset.y * m_viewportHeight;
+        return pos;
+    }
+    
+    auto Window::sprite_instance(
+        Sprout::Texture& texture,
+        const glm::vec2 position,
+        const glm::f32 layer,
+        const glm::f32 rotation,
+        const glm::i32 frameNum,
+        const glm::vec4 color_override,
+        const glm::vec3 scale,
+        const Pivot pivot,
+        const bool worldSpace,
+        QuadInstance& instance) -> bool
+    {
+        glm::vec2 size = texture.getSize();                
+        glm::vec2 frame_size = texture.getFrameSize();
+        glm::vec4 frame = glm::vec4(0.0f, 0.0f, size);
         
         if (frame_size != size)
         {
-            glm::i32 numFrames = texture->getNumFrames();
-            
-            glm::vec4 offset_uv = glm::vec4(
-                uv.x + ((uv.z - uv.x) / (float)numFrames) * (float)frameNum,
-                uv.y,
-                uv.x + ((uv.z - uv.x) / (float)numFrames) * ((float)frameNum + 1),
-                uv.w
-            );
-            uv = offset_uv;
+            frame = glm::vec4(frame_size.x * (float)frameNum, 0.0f, frame_size);
         }
         
-        // draw
-        if (worldSpace)
-        {
-            draw_rect_projected(draw_frame.view_projection * draw_frame.camera_xform * xform0, frame_size, layer, uv, color_override, pivot, 0);
-        }
-        else // ui elements are screen space
+        // the atlas only holds what trimming left of the frame, draw that where it sits in the whole frame
+        glm::vec4 rect, uv;
+        if (!texture.getPackedRegion(frame, rect, uv))
         {
-            draw_rect_projected(draw_frame.view_projection * xform0, frame_size, layer, uv, color_override, pivot, 0);
+            return false;
         }
+        const glm::vec2 pos = trimmed_position(position, rect, frame_size, glm::vec2(scale), rotation, pivot);
+        
+        // textures that need no blending go to the opaque pass
+        const uint8_t texture_index = texture.isOpaque() ? TEXTURE_INDEX_ATLAS + TEXTURE_FLAG_OPAQUE : TEXTURE_INDEX_ATLAS;
+        instance = make_instance(pos, glm::vec2(rect.z, rect.w), glm::vec2(scale), rotation, layer, uv, color_override, pivot, texture_index, static_cast<uint8_t>(texture.getAtlasPage()), worldSpace);
+        return true;
     }
     
     void Window::draw_rectangle(
@@ -323,79 +152,389 @@ namespace Sprout
         glm::vec4 color,
         bool worldSpace)
     {
-        // draw rectangle
-        auto xform = glm::translate(glm::mat4(1.0f), glm::vec3(x, y, 0.0f));
-        glm::vec4 uv = texture->getAtlasUVs();
-
-        if (worldSpace)
+        if (!in_view(glm::vec2(x, y), glm::vec2(width, height), glm::vec2(1.0f), 0.0f, Pivot::CENTER, worldSpace))
         {
-            draw_rect_projected(draw_frame.view_projection * draw_frame.camera_xform * xform, glm::vec2(width, height), 1.0f, uv, color, Pivot::CENTER, 0);
+            return;
         }
-        else
+        
+        // draw rectangle, the texture is stretched over it and so is its trim
+        glm::vec2 size = texture->getSize();
+        glm::vec4 rect, uv;
+        if (!texture->getPackedRegion(glm::vec4(0.0f, 0.0f, size), rect, uv))
         {
-            draw_rect_projected(draw_frame.view_projection * xform, glm::vec2(width, height), 1.0f, uv, color, Pivot::CENTER, 0);
+            return;
         }
+        glm::vec2 stretch = glm::vec2(width, height) / size;
+        rect *= glm::vec4(stretch, stretch);
+        
+        glm::vec2 pos = trimmed_position(glm::vec2(x, y), rect, glm::vec2(width, height), glm::vec2(1.0f), 0.0f, Pivot::CENTER);
+        draw_quad(make_instance(pos, glm::vec2(rect.z, rect.w), glm::vec2(1.0f), 0.0f, 1.0f, uv, color, Pivot::CENTER, TEXTURE_INDEX_ATLAS, static_cast<uint8_t>(texture->getAtlasPage()), worldSpace));
+    }
+    
+    auto Window::trimmed_position(
+        const glm::vec2 position,
+        const glm::vec4 rect,
+        const glm::vec2 frame_size,
+        const glm::vec2 scale,
+        const glm::f32 rotation,
+        const Pivot pivot) -> glm::vec2
+    {
+        // keeping the pivot, the trimmed quad is the whole one shifted by this before rotation and scale
+        const glm::vec2 offset = glm::vec2(rect.x, rect.y) + getPivotOffset(pivot) * (glm::vec2(rect.z, rect.w) - frame_size);
+        if (offset == glm::vec2(0.0f))
+        {
+            return position;
+        }
+        
+        if (rotation == 0.0f)
+        {
+            return position + offset * scale;
+        }
+        
+        // rotate then scale, the same as the vertex shader does to the corners
+        const glm::f32 sin_r = std::sin(rotation);
+        const glm::f32 cos_r = std::cos(rotation);
+        return position + glm::vec2(cos_r * offset.x - sin_r * offset.y, sin_r * offset.x + cos_r * offset.y) * scale;
     }
     
     
-    void Window::draw_rect_projected(
-        glm::mat4 projection,
+    auto Window::make_instance(
+        glm::vec2 position,
         glm::vec2 size,
+        glm::vec2 scale,
+        glm::f32 rotation,
         glm::f32 layer,
         glm::vec4 uv,
         glm::vec4 color_override,
         Pivot pivot,
-        uint8_t img_tex_id)
+        uint8_t img_tex_id,
+        uint8_t page,
+        bool worldSpace) -> QuadInstance
     {
-        glm::vec2 pivot_offset = getPivotOffset(pivot) * size;
-
-
-        glm::vec4 bottom_left = glm::vec4(0.0f - pivot_offset.x, 0.0f - pivot_offset.y, layer, 1.0f);
-        glm::vec4 bottom_right = glm::vec4(size.x - pivot_offset.x, 0.0f - pivot_offset.y, layer, 1.0f);
-        glm::vec4 top_left = glm::vec4(0.0f - pivot_offset.x, size.y - pivot_offset.y, layer, 1.0f);
-        glm::vec4 top_right = glm::vec4(size.x - pivot_offset.x, size.y - pivot_offset.y, layer, 1.0f);
+        // rotation is wrapped to [-pi, pi] and depth clamped to clip space before going to snorm16
+        const glm::f32 wrapped_rotation = std::remainder(rotation, glm::two_pi<glm::f32>());
+        const glm::vec2 pivot_halves = getPivotOffset(pivot) * 2.0f;
+        const glm::u8 pivot_index = static_cast<glm::u8>(pivot_halves.x * 3.0f + pivot_halves.y);
         
-        std::array<glm::vec4, 4> positions = {bottom_left, top_left, top_right, bottom_right};
-        glm::vec4 color = Color::White;;
-        std::array<glm::vec4, 4> colors = {color, color, color, color};
-        std::array<glm::vec2, 4> uvs = {
-            glm::vec2(uv.x, uv.y),
-            glm::vec2(uv.x, uv.w),
-            glm::vec2(uv.z, uv.w),
-            glm::vec2(uv.z, uv.y)
-        };
-        std::array<glm::vec4, 4> color_overrides = {color_override, color_override, color_override, color_override};
+        QuadInstance instance;
+        instance.pos = position;
+        instance.size_scale = glm::packHalf(glm::vec4(size, scale));
+        instance.rot_depth = glm::packSnorm<glm::i16>(glm::vec2(wrapped_rotation / glm::pi<glm::f32>(), layer));
+        instance.uv = glm::packUnorm<glm::u16>(uv);
+        instance.color_override = glm::packUnorm<glm::u8>(color_override);
+        instance.bytes = glm::u8vec4(img_tex_id, worldSpace ? 0 : 255, pivot_index, page);
+        return instance;
+    }
+    
+    
+    void Window::draw_quad(const QuadInstance& instance)
+    {
+        if (t_draw_stream >= 0)
+        {
+            m_draw_streams[t_draw_stream].quads.push_back(instance);
+            return;
+        }
+        if (m_static_chunk_open)
+        {
+            m_static_quads.push_back(instance);
+            return;
+        }
+        append_quad(instance);
+    }
+    
+    void Window::draw_quads(const QuadInstance* instances, int count)
+    {
+        if (t_draw_stream >= 0)
+        {
+            std::vector<QuadInstance>& quads = m_draw_streams[t_draw_stream].quads;
+            quads.insert(quads.end(), instances, instances + count);
+            return;
+        }
+        if (m_static_chunk_open)
+        {
+            m_static_quads.insert(m_static_quads.end(), instances, instances + count);
+            return;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            append_quad(instances[i]);
+        }
+    }
+    
+    void Window::append_quad(const QuadInstance& instance)
+    {
+        // grow by doubling, the arrays keep their size across frames so this settles after a few frames
+        if (draw_frame.num_quads == static_cast<int>(draw_frame.quads.size()))
+        {
+            const size_t capacity = std::max<size_t>(draw_frame.quads.size() * 2, 1);
+            draw_frame.quads.resize(capacity);
+            draw_frame.sort_keys.resize(capacity);
+        }
+        
+        draw_frame.quads[draw_frame.num_quads] = instance;
+        draw_frame.sort_keys[draw_frame.num_quads] = make_sort_key(instance, draw_frame.num_quads);
+        draw_frame.num_quads++;
+    }
+    
+    
+    void Window::beginStaticChunk()
+    {
+        assert(!m_static_chunk_open && "static chunks can't be nested");
+        m_static_chunk_open = true;
+        m_static_quads.clear();
+        m_static_bounds = glm::vec4(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+    }
+    
+    auto Window::endStaticChunk() -> int
+    {
+        assert(m_static_chunk_open && "endStaticChunk without beginStaticChunk");
+        m_static_chunk_open = false;
+        
+        // put the quads in the order the frame would have sorted them, once, so drawing needs no sort
+        const int count = static_cast<int>(m_static_quads.size());
+        std::vector<uint64_t> keys(count), scratch(count);
+        for (int i = 0; i < count; i++)
+        {
+            keys[i] = make_sort_key(m_static_quads[i], static_cast<uint32_t>(i));
+        }
+        const uint64_t* sorted_keys = radix_sort_keys(keys.data(), scratch.data(), count);
+        std::vector<QuadInstance> sorted(count);
+        const int num_opaque = gather_passes(sorted_keys, count, m_static_quads.data(), sorted.data(), nullptr);
+        
+        // the buffer is made before the next render, the simulation may be running on another thread
+        StaticChunk chunk;
+        chunk.num_quads = count;
+        chunk.num_opaque = num_opaque;
+        chunk.bounds = m_static_bounds;
+        chunk.in_use = true;
+        chunk.pending = std::move(sorted);
+        
+        // reuse released slots so ids stay small
+        for (size_t id = 0; id < m_static_chunks.size(); id++)
+        {
+            if (!m_static_chunks[id].in_use)
+            {
+                m_static_chunks[id] = chunk;
+                return static_cast<int>(id);
+            }
+        }
+        m_static_chunks.push_back(chunk);
+        return static_cast<int>(m_static_chunks.size() - 1);
+    }
+    
+    void Window::releaseStaticChunk(int chunk)
+    {
+        if (chunk < 0 || chunk >= static_cast<int>(m_static_chunks.size()) || !m_static_chunks[chunk].in_use)
+        {
+            return;
+        }
+        // the frame being rendered may still draw it, destroyed before the next one
+        if (m_static_chunks[chunk].buffer.id != SG_INVALID_ID)
+        {
+            m_pending_destroys.push_back(m_static_chunks[chunk].buffer);
+        }
+        m_static_chunks[chunk] = StaticChunk();
+    }
+    
+    void Window::draw_static_chunk(int chunk)
+    {
+        if (chunk < 0 || chunk >= static_cast<int>(m_static_chunks.size()) || m_static_chunks[chunk].num_quads == 0)
+        {
+            return;
+        }
         
-        draw_quad(projection, positions, colors, uvs, color_overrides, img_tex_id) ; 
+        const glm::vec4& bounds = m_static_chunks[chunk].bounds;
+        const glm::vec4& view = camera_matrices().world_view;
+        if (bounds.z < view.x || bounds.x > view.z || bounds.w < view.y || bounds.y > view.w)
+        {
+            m_culled_draws++;
+            return;
+        }
+        m_submitted_draws++;
+        draw_frame.static_chunks.push_back(chunk);
     }
     
+    auto Window::createRetainedBatch() -> int
+    {
+        m_retained_batches.emplace_back();
+        return static_cast<int>(m_retained_batches.size() - 1);
+    }
     
-    void Window::draw_quad(
-        glm::mat4 projection, 
-        std::array<glm::vec4, 4> positions,
-        std::array<glm::vec4, 4> colors,
-        std::array<glm::vec2, 4> uvs,
-        std::array<glm::vec4, 4> color_overrides,
-        uint8_t img_tex_id)
+    auto Window::acquireSpriteSlot(int batch) -> int
     {
-        if (draw_frame.num_quads > MAX_QUADS)
+        RetainedBatch& retained = m_retained_batches[batch];
+        if (!retained.free_slots.empty())
+        {
+            const int slot = retained.free_slots.back();
+            retained.free_slots.pop_back();
+            return slot;
+        }
+        
+        retained.inputs.emplace_back();
+        retained.instances.emplace_back();
+        retained.visible.push_back(0);
+        retained.positions.push_back(-1);
+        return static_cast<int>(retained.inputs.size() - 1);
+    }
+    
+    void Window::releaseSpriteSlot(int batch, int slot)
+    {
+        if (batch < 0 || batch >= static_cast<int>(m_retained_batches.size()))
         {
-            //throw std::runtime_error("Too many quads");
             return;
         }
+        RetainedBatch& retained = m_retained_batches[batch];
+        if (retained.visible[slot])
+        {
+            retained.visible[slot] = 0;
+            retained.order_dirty = true;
+        }
+        retained.inputs[slot] = SlotInputs();
+        retained.free_slots.push_back(slot);
+    }
+    
+    void Window::update_sprite_slot(
+        int batch,
+        int slot,
+        const std::shared_ptr<Sprout::Texture>& texture,
+        const glm::vec2 position,
+        const glm::f32 layer,
+        const glm::f32 rotation,
+        const glm::i32 frameNum,
+        const glm::vec4 color_override,
+        const glm::vec3 scale,
+        const Pivot pivot,
+        const bool worldSpace)
+    {
+        RetainedBatch& retained = m_retained_batches[batch];
         
-        for (int i = 0; i < 4; i++)
+        // most slots don't change from frame to frame, comparing the inputs is all they cost
+        const SlotInputs inputs = { texture.get(), position, layer, rotation, frameNum, color_override, scale, pivot, worldSpace };
+        if (inputs == retained.inputs[slot])
         {
-            Vertex& vertex = draw_frame.quads[draw_frame.num_quads].vertices[i];
-            
-            vertex.pos = projection * positions[i];
-            vertex.color = colors[i];
-            vertex.uv = uvs[i];
-            vertex.color_override = color_overrides[i];
-            vertex.bytes = img_tex_id;
+            return;
         }
+        retained.inputs[slot] = inputs;
         
-        draw_frame.num_quads++;
+        const glm::vec2 pos = worldSpace ? position : anchor_position(position, pivot);
+        // zeroed, sprite_instance leaves it untouched for culled sprites and the sort key still reads it
+        QuadInstance instance{};
+        const bool visible = sprite_instance(*texture, pos, layer, rotation, frameNum, color_override, scale, pivot, worldSpace, instance);
+        const bool moved = visible != static_cast<bool>(retained.visible[slot])
+            || make_sort_key(instance, 0) != make_sort_key(retained.instances[slot], 0);
+        retained.instances[slot] = instance;
+        retained.visible[slot] = visible;
+        
+        // a slot keeps its place in the buffer unless its depth, texture or visibility changed
+        if (moved)
+        {
+            retained.order_dirty = true;
+        }
+        else if (visible && !retained.order_dirty)
+        {
+            const int position_index = retained.positions[slot];
+            retained.ordered[position_index] = instance;
+            retained.dirty_end = std::max(retained.dirty_end, position_index + 1);
+        }
+    }
+    
+    void Window::draw_retained_batch(int batch)
+    {
+        if (batch < 0 || batch >= static_cast<int>(m_retained_batches.size()) || m_retained_batches[batch].queued)
+        {
+            return;
+        }
+        m_retained_batches[batch].queued = true;
+        draw_frame.retained_batches.push_back(batch);
+    }
+    
+    auto Window::make_sort_key(const QuadInstance& instance, uint32_t index) -> uint64_t
+    {
+        // flip the snorm16 depth so the deepest quads sort first
+        const uint64_t depth = static_cast<uint64_t>(32767 - instance.rot_depth.y);
+        const uint64_t texture = instance.bytes.x;
+        const uint64_t page = instance.bytes.w;
+        return (depth << 48) | (texture << 40) | (page << 32) | index;
+    }
+    
+    
+    auto Window::gather_passes(const uint64_t* keys, int count, const QuadInstance* quads, QuadInstance* gathered, uint64_t* translucent_keys) -> int
+    {
+        const auto is_opaque = [](uint64_t key) { return ((key >> 40) & TEXTURE_FLAG_OPAQUE) != 0; };
+        int num_opaque = 0;
+        for (int i = 0; i < count; i++)
+        {
+            num_opaque += is_opaque(keys[i]) ? 1 : 0;
+        }
+        
+        // opaque quads front to back so the depth test rejects what they cover, but in key order within a depth
+        // so the later one still wins a tie, it passes the less-equal test and is drawn last
+        int opaque = 0;
+        for (int end = count; end > 0;)
+        {
+            const uint64_t depth = keys[end - 1] >> 48;
+            int begin = end - 1;
+            while (begin > 0 && (keys[begin - 1] >> 48) == depth)
+            {
+                begin--;
+            }
+            for (int i = begin; i < end; i++)
+            {
+                if (is_opaque(keys[i]))
+                {
+                    gathered[opaque++] = quads[static_cast<uint32_t>(keys[i])];
+                }
+            }
+            end = begin;
+        }
+        
+        // the rest back to front for blending
+        int translucent = num_opaque;
+        for (int i = 0; i < count; i++)
+        {
+            if (!is_opaque(keys[i]))
+            {
+                if (translucent_keys != nullptr)
+                {
+                    translucent_keys[translucent - num_opaque] = keys[i];
+                }
+                gathered[translucent++] = quads[static_cast<uint32_t>(keys[i])];
+            }
+        }
+        return num_opaque;
+    }
+    
+    auto Window::radix_sort_keys(uint64_t* keys, uint64_t* scratch, int count) -> const uint64_t*
+    {
+        // the lower 32 bits are the submission index and already ascending, so only the upper half needs sorting
+        uint64_t* src = keys;
+        uint64_t* dst = scratch;
+        for (int shift = 32; shift < 64; shift += 8)
+        {
+            std::array<int, 256> offsets = {};
+            for (int i = 0; i < count; i++)
+            {
+                offsets[(src[i] >> shift) & 0xFF]++;
+            }
+            if (count == 0 || offsets[(src[0] >> shift) & 0xFF] == count)
+            {
+                continue;
+            }
+            
+            int offset = 0;
+            for (int& bucket : offsets)
+            {
+                const int bucket_count = bucket;
+                bucket = offset;
+                offset += bucket_count;
+            }
+            for (int i = 0; i < count; i++)
+            {
+                dst[offsets[(src[i] >> shift) & 0xFF]++] = src[i];
+            }
+            std::swap(src, dst);
+        }
+        return src;
     }
     
     void Window::draw_standalone_texture(
@@ -407,59 +546,126 @@ namespace Sprout
         Pivot pivot,
         glm::vec4 color_override)
     {
-        if (draw_frame.num_images >= MAX_STANDALONE_TEXTURES) {
-            return; // no more space for standalone textures
+        if (!in_view(position, texture->getSize(), glm::vec2(scale), rotation, pivot, true))
+        {
+            return;
         }
         
-        glm::mat4 xform0 = glm::mat4(1.0f);
-        
-
-        // translate
-        xform0 = glm::translate(xform0, glm::vec3(position, 0.0f));
+        // standalone textures are always world space and use the whole image
+        const QuadInstance instance = make_instance(
+            position,
+            texture->getSize(),
+            glm::vec2(scale),
+            rotation,
+            depth,
+            glm::vec4(0.0f, 0.0f, 1.0f, 1.0f),
+            color_override,
+            pivot,
+            TEXTURE_INDEX_IMAGE,
+            0,
+            true
+        );
+        if (t_draw_stream >= 0)
+        {
+            m_draw_streams[t_draw_stream].standalone_quads.push_back(instance);
+            m_draw_streams[t_draw_stream].images.push_back(texture->getImageHandle());
+            return;
+        }
+        draw_standalone_quad(instance, texture->getImageHandle());
+    }
+    
+    void Window::draw_standalone_quad(const QuadInstance& instance, sg_image image)
+    {
+        // the quad names its image by its index in the frame's images, render_frame turns that into a slot
+        const auto it = std::find_if(draw_frame.images.begin(), draw_frame.images.end(), [image](sg_image other) { return other.id == image.id; });
+        const size_t layer = static_cast<size_t>(it - draw_frame.images.begin());
+        if (layer == MAX_FRAME_IMAGES) {
+            m_dropped_draws++;
+            return; // no more space for standalone textures
+        }
+        if (it == draw_frame.images.end())
+        {
+            draw_frame.images.push_back(image);
+        }
         
-        // scale
-        xform0 = glm::scale(xform0, scale);
+        QuadInstance layered = instance;
+        layered.bytes.w = static_cast<uint8_t>(layer);
+        append_quad(layered);
+        draw_frame.num_images++;
+    }
+    
+    void Window::beginDrawStreams(size_t count)
+    {
+        assert(!m_static_chunk_open && "draw streams can't record into a static chunk");
         
-        // rotate
-        xform0 = glm::rotate(xform0, rotation, glm::vec3(0.0f, 0.0f, 1.0f));
+        // build the camera matrices now, the threads only read them
+        camera_matrices();
         
-        // draw
+        if (m_draw_streams.size() < count)
+        {
+            m_draw_streams.resize(count);
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            DrawStream& stream = m_draw_streams[i];
+            stream.quads.clear();
+            stream.standalone_quads.clear();
+            stream.images.clear();
+            stream.culled_draws = 0;
+            stream.submitted_draws = 0;
+        }
+        m_num_draw_streams = count;
+    }
+    
+    void Window::setDrawStream(int stream)
+    {
+        t_draw_stream = stream;
+    }
+    
+    void Window::endDrawStreams()
+    {
+        // every stream's place in the frame, in stream order
+        std::vector<int> offsets(m_num_draw_streams);
+        int total = draw_frame.num_quads;
+        for (size_t i = 0; i < m_num_draw_streams; i++)
+        {
+            offsets[i] = total;
+            total += static_cast<int>(m_draw_streams[i].quads.size());
+            m_culled_draws += m_draw_streams[i].culled_draws;
+            m_submitted_draws += m_draw_streams[i].submitted_draws;
+        }
+        if (total > static_cast<int>(draw_frame.quads.size()))
+        {
+            const size_t capacity = std::max<size_t>(draw_frame.quads.size() * 2, total);
+            draw_frame.quads.resize(capacity);
+            draw_frame.sort_keys.resize(capacity);
+        }
         
-        glm::vec2 size = texture->getSize();
+        // the streams are copied and keyed in parallel, each into its own range
+        JobSystem::parallelFor(m_num_draw_streams, 1, [this, &offsets](size_t, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                const std::vector<QuadInstance>& quads = m_draw_streams[i].quads;
+                std::copy(quads.begin(), quads.end(), draw_frame.quads.begin() + offsets[i]);
+                for (size_t q = 0; q < quads.size(); q++)
+                {
+                    const uint32_t index = static_cast<uint32_t>(offsets[i] + q);
+                    draw_frame.sort_keys[index] = make_sort_key(quads[q], index);
+                }
+            }
+        });
+        draw_frame.num_quads = total;
         
-        glm::vec2 pivot_offset = getPivotOffset(pivot) * size;
-
-
-        glm::vec4 bottom_left = glm::vec4(0.0f - pivot_offset.x, 0.0f - pivot_offset.y, depth, 1.0f);
-        glm::vec4 bottom_right = glm::vec4(size.x - pivot_offset.x, 0.0f - pivot_offset.y, depth, 1.0f);
-        glm::vec4 top_left = glm::vec4(0.0f - pivot_offset.x, size.y - pivot_offset.y, depth, 1.0f);
-        glm::vec4 top_right = glm::vec4(size.x - pivot_offset.x, size.y - pivot_offset.y, depth, 1.0f);
-        
-        std::array<glm::vec4, 4> positions = {bottom_left, top_left, top_right, bottom_right};
-        glm::vec4 color = Color::White;;
-        std::array<glm::vec4, 4> colors = {color, color, color, color};
-        std::array<glm::vec2, 4> uvs = {
-            glm::vec2(0.0f, 0.0f),
-            glm::vec2(0.0f, 1.0f),
-            glm::vec2(1.0f, 1.0f),
-            glm::vec2(1.0f, 0.0f)
-        };
-        std::array<glm::vec4, 4> color_overrides = {color_override, color_override, color_override, color_override};
-        
-        glm::mat4 projection = draw_frame.view_projection * draw_frame.camera_xform * xform0;
-        
-        for (int i = 0; i < 4; i++)
-        {
-            Vertex& vertex = draw_frame.standalone_quads[draw_frame.num_images].vertices[i];
-            
-            vertex.pos = projection * positions[i];
-            vertex.color = colors[i];
-            vertex.uv = uvs[i];
-            vertex.color_override = color_overrides[i];
-            vertex.bytes = 0;
+        for (size_t i = 0; i < m_num_draw_streams; i++)
+        {
+            const DrawStream& stream = m_draw_streams[i];
+            for (size_t q = 0; q < stream.standalone_quads.size(); q++)
+            {
+                draw_standalone_quad(stream.standalone_quads[q], stream.images[q]);
+            }
         }
-        draw_frame.images[draw_frame.num_images] = texture->getImageHandle();
-        draw_frame.num_images++;
+        m_num_draw_streams = 0;
     }
     
     glm::vec2 Window::screenToWorld(glm::vec2 screen_pos) 
@@ -470,7 +676,7 @@ namespace Sprout
             return glm::vec2(-1.0f, -1.0f);
         }
     
-        glm::mat4 inv_proj = glm::inverse(Window::getInstance()->draw_frame.view_projection * Window::getInstance()->draw_frame.camera_xform);
+        const glm::mat4& inv_proj = Instance->camera_matrices().inverse_world_vp;
  
         glm::vec4 world_pos = inv_proj * glm::vec4(viewport_pos.x, viewport_pos.y, 0.0f, 1.0f);
         
@@ -479,22 +685,24 @@ namespace Sprout
     
         void Window::updateViewport()
         {
-            float window_aspect = static_cast<float>(sapp_width()) / static_cast<float>(sapp_height());
+            const int window_width = getWidth();
+            const int window_height = getHeight();
+            float window_aspect = static_cast<float>(window_width) / static_cast<float>(window_height);
     
             int viewport_x, viewport_y, viewport_width, viewport_height;
     
             if (window_aspect > m_viewportAspectRatio) {
                 // window is wider than the target aspect - letterboxing on sides
-                viewport_height = sapp_height();
-                viewport_width = static_cast<int>(sapp_height() * m_viewportAspectRatio);
+                viewport_height = window_height;
+                viewport_width = static_cast<int>(window_height * m_viewportAspectRatio);
                 viewport_y = 0;
-                viewport_x = (sapp_width() - viewport_width) / 2;
+                viewport_x = (window_width - viewport_width) / 2;
             } else {
                 // window is taller than the target aspect - letterboxing on top/bottom
-                viewport_width = sapp_width();
-                viewport_height = static_cast<int>(sapp_width() / m_viewportAspectRatio);
+                viewport_width = window_width;
+                viewport_height = static_cast<int>(window_width / m_viewportAspectRatio);
                 viewport_x = 0;
-                viewport_y = (sapp_height() - viewport_height) / 2;
+                viewport_y = (window_height - viewport_height) / 2;
             }
     
             draw_frame.viewport = glm::vec4(viewport_x, viewport_y, viewport_width, viewport_height);
@@ -538,6 +746,80 @@ namespace Sprout
             return glm::vec2(viewport_x, viewport_y);
         }
 
+    auto Window::camera_matrices() -> const CameraMatrices&
+    {
+        // draw_frame is public, so compare against what the cache was built from instead of tracking every write
+        if (m_camera_matrices.view_projection != draw_frame.view_projection || m_camera_matrices.camera_xform != draw_frame.camera_xform)
+        {
+            m_camera_matrices.view_projection = draw_frame.view_projection;
+            m_camera_matrices.camera_xform = draw_frame.camera_xform;
+            m_camera_matrices.world_vp = draw_frame.view_projection * draw_frame.camera_xform;
+            m_camera_matrices.inverse_world_vp = glm::inverse(m_camera_matrices.world_vp);
+            
+            // the corners of clip space taken back through each matrix
+            auto view_bounds = [](const glm::mat4& inverse) {
+                glm::vec2 min = glm::vec2(INFINITY), max = glm::vec2(-INFINITY);
+                for (glm::vec2 corner : { glm::vec2(-1.0f, -1.0f), glm::vec2(1.0f, -1.0f), glm::vec2(-1.0f, 1.0f), glm::vec2(1.0f, 1.0f) })
+                {
+                    const glm::vec2 p = glm::vec2(inverse * glm::vec4(corner, 0.0f, 1.0f));
+                    min = glm::min(min, p);
+                    max = glm::max(max, p);
+                }
+                return glm::vec4(min, max);
+            };
+            m_camera_matrices.world_view = view_bounds(m_camera_matrices.inverse_world_vp);
+            m_camera_matrices.screen_view = view_bounds(glm::inverse(draw_frame.view_projection));
+        }
+        return m_camera_matrices;
+    }
+    
+    auto Window::in_view(
+        const glm::vec2 position,
+        const glm::vec2 size,
+        const glm::vec2 scale,
+        const glm::f32 rotation,
+        const Pivot pivot,
+        const bool worldSpace) -> bool
+    {
+        const glm::vec2 pivot_offset = getPivotOffset(pivot);
+        glm::vec2 min, max;
+        if (rotation == 0.0f)
+        {
+            const glm::vec2 a = -pivot_offset * size * scale;
+            const glm::vec2 b = (1.0f - pivot_offset) * size * scale;
+            min = position + glm::min(a, b);
+            max = position + glm::max(a, b);
+        }
+        else
+        {
+            // scale is applied after rotation, so the circle becomes an ellipse along the axes
+            const glm::vec2 extent = glm::length(glm::max(pivot_offset, 1.0f - pivot_offset) * size) * glm::abs(scale);
+            min = position - extent;
+            max = position + extent;
+        }
+        
+        // a static chunk is culled as a whole when it's drawn, so while recording one only its bounds grow
+        if (m_static_chunk_open)
+        {
+            m_static_bounds = glm::vec4(glm::min(glm::vec2(m_static_bounds), min), glm::max(glm::vec2(m_static_bounds.z, m_static_bounds.w), max));
+            return true;
+        }
+        
+        const CameraMatrices& camera = camera_matrices();
+        const glm::vec4& view = worldSpace ? camera.world_view : camera.screen_view;
+        const bool visible = max.x >= view.x && min.x <= view.z && max.y >= view.y && min.y <= view.w;
+        if (t_draw_stream >= 0)
+        {
+            DrawStream& stream = m_draw_streams[t_draw_stream];
+            (visible ? stream.submitted_draws : stream.culled_draws)++;
+        }
+        else
+        {
+            (visible ? m_submitted_draws : m_culled_draws)++;
+        }
+        return visible;
+    }
+    
     void Window::translateCamera(glm::f32 deltaX, glm::f32 deltaY)
     {
         draw_frame.camera_xform = glm::translate(
@@ -574,124 +856,150 @@ namespace Sprout
     
     void Window::draw_text(const std::string& text, const std::shared_ptr<Font>& font, glm::vec2 position, float depth, glm::vec4 color, float scale, Pivot pivot, bool worldSpace, Sprout::TextJustify justify)
     {
-        
-        // first pass: get the total sizes
-        float totalWidth = 0.0f, maxHeight = 0.0f;
+        // each thread keeps the last layout it made, so drawing the same string again skips the layout too
+        static thread_local TextLayout t_text_layout;
+        layout_text(text, font, scale, t_text_layout);
+        draw_text_layout(t_text_layout, position, depth, color, scale, pivot, worldSpace, justify);
+    }
+    
+    void Window::layout_text(const std::string& text, const std::shared_ptr<Font>& font, float scale, TextLayout& layout)
+    {
+        // glyphs are rasterized at the size they're drawn at, to the pixel, and scaled the rest of the way
+        int pixel_size = std::clamp(static_cast<int>(std::lround(font->size * scale)), MIN_GLYPH_SIZE, MAX_GLYPH_SIZE);
+        if (font->sdf)
         {
-            float temp_x = 0.0f, temp_y = 0.0f;
-            
-            for (char c : text)
-            {
-                int char_index = c - 32;
-                
-                float advance_x = temp_x, advance_y = temp_y;
-                stbtt_aligned_quad quad;
-                
-                stbtt_GetBakedQuad
-                (
-                    font->bakedChars, 
-                    m_fontAtlases[font->fontId].width, 
-                    m_fontAtlases[font->fontId].height, 
-                    char_index, 
-                    &advance_x, 
-                    &advance_y, 
-                    &quad, 
-                    1
-                );
-                
-                temp_x = advance_x;
-                temp_y = advance_y;
-                
-                float charHeight = quad.y1 - quad.y0;
-                if (charHeight > maxHeight) maxHeight = charHeight;
-            }
-            
-            totalWidth = temp_x;
+            pixel_size = SDF_GLYPH_SIZE;
+        }
+        if (layout.font == font.get() && layout.pixel_size == pixel_size && layout.text == text)
+        {
+            return;
         }
+        layout.text = text;
+        layout.font = font.get();
+        layout.pixel_size = pixel_size;
+        lay_out(layout);
+    }
+    
+    void Window::lay_out(TextLayout& layout)
+    {
+        const Font& font = *layout.font;
+        layout.glyphs.clear();
+        layout.pages = 0;
+        layout.built = false;
         
-        glm::mat4 globalXform = glm::mat4(1.0f);
+        // held over the whole string, so no page it uses is cleared before it's done
+        auto lock = m_glyph_cache.lock();
+        layout.generation = m_glyph_cache.getGeneration();
         
-        if (worldSpace)
+        const float kern_scale = stbtt_ScaleForPixelHeight(&font.info, static_cast<float>(layout.pixel_size));
+        float x = 0.0f, maxHeight = 0.0f;
+        uint32_t previous = 0;
+        for (size_t i = 0; i < layout.text.size();)
         {
-            glm::vec2 adjustedPosition = position;
-            if (justify == Sprout::TextJustify::CENTER)
-            {
-                adjustedPosition.x -= (totalWidth * scale) / 2.0f;
-            } 
-            else if (justify == Sprout::TextJustify::RIGHT)
+            const uint32_t codepoint = GlyphCache::decodeUtf8(layout.text, i);
+            if (previous != 0)
             {
-                adjustedPosition.x -= totalWidth * scale;
+                x += kern_scale * stbtt_GetCodepointKernAdvance(&font.info, static_cast<int>(previous), static_cast<int>(codepoint));
             }
-            globalXform = glm::translate(globalXform, glm::vec3(adjustedPosition, 0.0f));
-        }
-        else 
-        {
-            glm::vec2 anchor_offset = getAnchorOffset(pivot);
-            glm::vec2 pos;
+            previous = codepoint;
             
-            pos.x = (anchor_offset.x != 0) ? -position.x * anchor_offset.x : position.x;
-            pos.y = (anchor_offset.y != 0) ? -position.y * anchor_offset.y : -position.y;
-            
-            pos.x += anchor_offset.x * m_viewportWidth;
-            pos.y += anchor_offset.y * m_viewportHeight;
-            
-            if (justify == Sprout::TextJustify::CENTER)
-            {
-                pos.x -= (totalWidth * scale) / 2.0f;
-            } 
-            else if (justify == Sprout::TextJustify::RIGHT)
+            const GlyphCache::Glyph& cached = m_glyph_cache.get(font, layout.pixel_size, codepoint);
+            if (cached.page >= 0)
             {
-                pos.x -= totalWidth * scale;
+                TextGlyph glyph;
+                glyph.offset = glm::vec2(std::floor(x + 0.5f), 0.0f) + cached.offset;
+                glyph.size = cached.size;
+                glyph.uv = cached.uv;
+                glyph.page = static_cast<uint8_t>(cached.page);
+                layout.glyphs.push_back(glyph);
+                layout.pages |= 1u << cached.page;
+                maxHeight = std::max(maxHeight, glyph.size.y);
             }
-            
-            globalXform = glm::translate(globalXform, glm::vec3(pos, 0.0f));
+            x += cached.advance;
         }
-
-
-        globalXform = glm::scale(globalXform, glm::vec3(scale, scale, 1.0f));
+        layout.size = glm::vec2(x, maxHeight);
+        layout.pixel_scale = font.size / static_cast<float>(layout.pixel_size);
+    }
+    
+    void Window::draw_text_layout(TextLayout& layout, glm::vec2 position, float depth, glm::vec4 color, float scale, Pivot pivot, bool worldSpace, Sprout::TextJustify justify)
+    {
+        assert(layout.font != nullptr && "draw_text_layout before layout_text");
         
-        float x = 0, y = 0;
+        // a page the layout uses was cleared for other glyphs, they're rasterized again
+        if (!m_glyph_cache.touch(layout.pages, layout.generation))
+        {
+            lay_out(layout);
+        }
         
-        // second pass: render text with pivot and justify transformations
-        for (char c : text)
+        // screen space text is anchored to the viewport, so its size is an input too
+        TextLayout::DrawInputs inputs = { position, depth, color, scale, pivot, worldSpace, justify, glm::vec2(0.0f) };
+        if (!worldSpace)
         {
-            int char_index = c - 32;
-            
-            float advance_x = x, advance_y = y;
-            stbtt_aligned_quad quad;
-            
-            stbtt_GetBakedQuad
-            (
-                font->bakedChars, 
-                m_fontAtlases[font->fontId].width, 
-                m_fontAtlases[font->fontId].height, 
-                char_index, 
-                &advance_x, 
-                &advance_y, 
-                &quad, 
-                1
-            );
-            
-            glm::vec2 size = glm::vec2(quad.x1 - quad.x0, quad.y1 - quad.y0);
-            
-            glm::mat4 charXform = globalXform;
-            charXform = glm::translate(charXform, glm::vec3(quad.x0, quad.y0, 0.0f));
-            glm::vec4 uv = glm::vec4(quad.s0, quad.t0, quad.s1, quad.t1);
+            inputs.viewport = glm::vec2(m_viewportWidth, m_viewportHeight);
+        }
+        
+        if (!layout.built || !(inputs == layout.inputs))
+        {
+            // the layout is in pixels of the size it was rasterized at
+            const float totalWidth = layout.size.x * layout.pixel_scale;
+            glm::vec2 origin = position;
             
-            glm::mat4 projection;
             if (worldSpace)
             {
-                projection = draw_frame.view_projection * draw_frame.camera_xform * charXform;            
+                if (justify == Sprout::TextJustify::CENTER)
+                {
+                    origin.x -= (totalWidth * scale) / 2.0f;
+                } 
+                else if (justify == Sprout::TextJustify::RIGHT)
+                {
+                    origin.x -= totalWidth * scale;
+                }
             }
-            else
+            else 
             {
-                projection = draw_frame.view_projection * charXform;
+                glm::vec2 anchor_offset = getAnchorOffset(pivot);
+                glm::vec2 pos;
+                
+                pos.x = (anchor_offset.x != 0) ? -position.x * anchor_offset.x : position.x;
+                pos.y = (anchor_offset.y != 0) ? -position.y * anchor_offset.y : -position.y;
+                
+                pos.x += anchor_offset.x * m_viewportWidth;
+                pos.y += anchor_offset.y * m_viewportHeight;
+                
+                if (justify == Sprout::TextJustify::CENTER)
+                {
+                    pos.x -= (totalWidth * scale) / 2.0f;
+                } 
+                else if (justify == Sprout::TextJustify::RIGHT)
+                {
+                    pos.x -= totalWidth * scale;
+                }
+                
+                origin = pos;
             }
-            draw_rect_projected(projection, size, depth, uv, color, Pivot::TOP_LEFT, font->fontId+1);
             
-            x = advance_x;
-            y = advance_y;
+            const float glyph_scale = scale * layout.pixel_scale;
+            const uint8_t tex_index = layout.font->sdf ? TEXTURE_INDEX_SDF_FONT : TEXTURE_INDEX_FONT;
+            layout.instances.clear();
+            for (const TextGlyph& glyph : layout.glyphs)
+            {
+                const glm::vec2 char_pos = origin + glyph.offset * glyph_scale;
+                layout.instances.push_back(make_instance(char_pos, glyph.size, glm::vec2(glyph_scale), 0.0f, depth, glyph.uv, color, Pivot::TOP_LEFT, tex_index, glyph.page, worldSpace));
+            }
+            layout.inputs = inputs;
+            layout.origin = origin;
+            layout.built = true;
         }
+        
+        // glyphs hang above the baseline at origin and may drop below it by as much again
+        const float maxHeight = layout.size.y;
+        const glm::vec2 glyph_scale = glm::vec2(scale * layout.pixel_scale);
+        if (!in_view(layout.origin - glm::vec2(0.0f, maxHeight * glyph_scale.y), glm::vec2(layout.size.x, maxHeight * 2.0f), glyph_scale, 0.0f, Pivot::TOP_LEFT, worldSpace))
+        {
+            return;
+        }
+        
+        draw_quads(layout.instances.data(), static_cast<int>(layout.instances.size()));
     }
 
 }
\ No newline at end of file
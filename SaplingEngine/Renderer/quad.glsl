@@ -4,21 +4,42 @@
 // VERTEX SHADER
 //
 @vs vs
-in vec4 position0;
-in vec4 color0;
-in vec2 uv0;
-in vec4 color_override0;
-in vec4 bytes0;
+layout(binding=0) uniform vs_params {
+	mat4 world_vp;
+	mat4 screen_vp;
+};
+
+// per-vertex: corner of the unit quad
+in vec2 corner0;
+
+// per-instance, quantized on the cpu (see Sprout::QuadInstance)
+in vec2 pos0;            // position of the pivot
+in vec4 size_scale0;     // half floats, xy: frame size in pixels, zw: scale
+in vec2 rot_depth0;      // snorm16, x: rotation / pi, y: depth
+in vec4 uv_rect0;        // unorm16, xy: uv of corner (0,0), zw: uv of corner (1,1)
+in vec4 color_override0; // unorm8
+in vec4 bytes0;          // unorm8, x: texture index, y: screen space flag, z: pivot (x * 3 + y in halves of the frame), w: atlas page
 
-out vec4 color;
 out vec2 uv;
 out vec4 color_override;
 out vec4 bytes;
 
 void main() {
-	gl_Position = position0;
-	color = color0;
-	uv = uv0;
+	float pivot_index = floor(bytes0.z * 255.0 + 0.5);
+	float pivot_x = floor((pivot_index + 0.5) / 3.0);
+	vec2 pivot = vec2(pivot_x, pivot_index - pivot_x * 3.0) * 0.5;
+	vec2 quad_pos = (corner0 - pivot) * size_scale0.xy;
+	float rotation = rot_depth0.x * 3.14159265;
+	float sin_r = sin(rotation);
+	float cos_r = cos(rotation);
+	vec2 world_pos = pos0 + vec2(cos_r * quad_pos.x - sin_r * quad_pos.y, sin_r * quad_pos.x + cos_r * quad_pos.y) * size_scale0.zw;
+
+	mat4 vp = world_vp;
+	if (bytes0.y > 0.5) {
+		vp = screen_vp;
+	}
+	gl_Position = vp * vec4(world_pos, rot_depth0.y, 1.0);
+	uv = mix(uv_rect0.xy, uv_rect0.zw, corner0);
 	color_override = color_override0;
 	bytes = bytes0;
 }
@@ -29,11 +50,22 @@ void main() {
 // FRAGMENT SHADER
 //
 @fs fs
-layout(binding=0) uniform texture2D texture0;
-layout(binding=1) uniform texture2D fontTex1;
+// standalone images, up to 8 per draw, picked by the slot in bytes.w
+layout(binding=0) uniform texture2D image0;
+layout(binding=1) uniform texture2D image1;
+layout(binding=2) uniform texture2D image2;
+layout(binding=3) uniform texture2D image3;
+layout(binding=4) uniform texture2D image4;
+layout(binding=5) uniform texture2D image5;
+layout(binding=6) uniform texture2D image6;
+layout(binding=7) uniform texture2D image7;
+// one layer per glyph cache page, one per atlas page
+layout(binding=8) uniform texture2DArray fontPages8;
+layout(binding=9) uniform texture2DArray atlasPages9;
 layout(binding=0) uniform sampler default_sampler;
+// linear, distance field glyphs are interpolated between texels
+layout(binding=1) uniform sampler glyph_sampler;
 
-in vec4 color;
 in vec2 uv;
 in vec4 color_override;
 in vec4 bytes;
@@ -42,18 +74,59 @@ out vec4 col_out;
 
 void main() {
 
-	int tex_index = int(bytes.x * 255.0);
+	// 0: standalone image slot bytes.w, 1: font bytes.w, 2: atlas page bytes.w, 3: distance field font bytes.w,
+	// +128 if drawn in the opaque pass
+	int tex_byte = int(bytes.x * 255.0 + 0.5);
+	int tex_index = tex_byte & 127;
+	float layer = floor(bytes.w * 255.0 + 0.5);
 	
 	vec4 tex_col = vec4(1.0);
 	if (tex_index == 0) {
-		tex_col = texture(sampler2D(texture0, default_sampler), uv);
+		int slot = int(layer);
+		if (slot == 0) {
+			tex_col = texture(sampler2D(image0, default_sampler), uv);
+		}
+		else if (slot == 1) {
+			tex_col = texture(sampler2D(image1, default_sampler), uv);
+		}
+		else if (slot == 2) {
+			tex_col = texture(sampler2D(image2, default_sampler), uv);
+		}
+		else if (slot == 3) {
+			tex_col = texture(sampler2D(image3, default_sampler), uv);
+		}
+		else if (slot == 4) {
+			tex_col = texture(sampler2D(image4, default_sampler), uv);
+		}
+		else if (slot == 5) {
+			tex_col = texture(sampler2D(image5, default_sampler), uv);
+		}
+		else if (slot == 6) {
+			tex_col = texture(sampler2D(image6, default_sampler), uv);
+		}
+		else if (slot == 7) {
+			tex_col = texture(sampler2D(image7, default_sampler), uv);
+		}
 	} 
 	else if (tex_index == 1) {
-		tex_col = texture(sampler2D(fontTex1, default_sampler), uv);
+		tex_col = texture(sampler2DArray(fontPages8, default_sampler), vec3(uv, layer));
+	}
+	else if (tex_index == 2) {
+		tex_col = texture(sampler2DArray(atlasPages9, default_sampler), vec3(uv, layer));
+	}
+	else if (tex_index == 3) {
+		// the edge is at 0.5, smoothed over about a screen pixel whatever size the glyph is drawn at
+		float dist = texture(sampler2DArray(fontPages8, glyph_sampler), vec3(uv, layer)).a;
+		float width = fwidth(dist);
+		tex_col = vec4(1.0, 1.0, 1.0, smoothstep(0.5 - width, 0.5 + width, dist));
+	}
+	
+	// the opaque pass writes depth without blending, pixels that would blend away are dropped instead
+	if (tex_byte >= 128 && tex_col.a < 0.5) {
+		discard;
 	}
 	
 	col_out = tex_col;
-	col_out *= color;
 	
 	col_out.rgb = mix(col_out.rgb, color_override.rgb, color_override.a);
 }
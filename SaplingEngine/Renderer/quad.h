@@ -1,10 +1,9 @@
 #pragma once
 /*
-    #version:1# (machine generated, don't edit!)
-
-    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
-
-    Cmdline:
+    Checked-in build of quad.glsl, kept in the layout of sokol-shdc
+    (https://github.com/floooh/sokol-tools). Edit quad.glsl, not this file.
+    CMake rebuilds the header from quad.glsl whenever sokol-shdc is found;
+    to refresh this copy by hand run:
         sokol-shdc --input quad.glsl --output quad.h -l hlsl5:glsl410:wgsl:metal_macos
 
     Overview:
@@ -14,25 +13,73 @@
         Vertex Shader: vs
         Fragment Shader: fs
         Attributes:
-            ATTR_quad_position0 => 0
-            ATTR_quad_color0 => 1
-            ATTR_quad_uv0 => 2
-            ATTR_quad_color_override0 => 3
-            ATTR_quad_bytes0 => 4
+            ATTR_quad_corner0 => 0
+            ATTR_quad_pos0 => 1
+            ATTR_quad_size_scale0 => 2
+            ATTR_quad_rot_depth0 => 3
+            ATTR_quad_uv_rect0 => 4
+            ATTR_quad_color_override0 => 5
+            ATTR_quad_bytes0 => 6
     Bindings:
-        Image 'texture0':
+        Uniform block 'vs_params':
+            C struct: vs_params_t
+            Bind slot: UB_vs_params => 0
+        Image 'image0':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_image0 => 0
+        Image 'image1':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_image1 => 1
+        Image 'image2':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_image2 => 2
+        Image 'image3':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_image3 => 3
+        Image 'image4':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_image4 => 4
+        Image 'image5':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_image5 => 5
+        Image 'image6':
             Image type: SG_IMAGETYPE_2D
             Sample type: SG_IMAGESAMPLETYPE_FLOAT
             Multisampled: false
-            Bind slot: IMG_texture0 => 0
-        Image 'fontTex1':
+            Bind slot: IMG_image6 => 6
+        Image 'image7':
             Image type: SG_IMAGETYPE_2D
             Sample type: SG_IMAGESAMPLETYPE_FLOAT
             Multisampled: false
-            Bind slot: IMG_fontTex1 => 1
+            Bind slot: IMG_image7 => 7
+        Image 'fontPages8':
+            Image type: SG_IMAGETYPE_ARRAY
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_fontPages8 => 8
+        Image 'atlasPages9':
+            Image type: SG_IMAGETYPE_ARRAY
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG_atlasPages9 => 9
         Sampler 'default_sampler':
             Type: SG_SAMPLERTYPE_FILTERING
             Bind slot: SMP_default_sampler => 0
+        Sampler 'glyph_sampler':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_glyph_sampler => 1
 */
 #if !defined(SOKOL_GFX_INCLUDED)
 #error "Please include sokol_gfx.h before quad.h"
@@ -44,315 +91,754 @@
 #define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
 #endif
 #endif
-#define ATTR_quad_position0 (0)
-#define ATTR_quad_color0 (1)
-#define ATTR_quad_uv0 (2)
-#define ATTR_quad_color_override0 (3)
-#define ATTR_quad_bytes0 (4)
-#define IMG_texture0 (0)
-#define IMG_fontTex1 (1)
+#define ATTR_quad_corner0 (0)
+#define ATTR_quad_pos0 (1)
+#define ATTR_quad_size_scale0 (2)
+#define ATTR_quad_rot_depth0 (3)
+#define ATTR_quad_uv_rect0 (4)
+#define ATTR_quad_color_override0 (5)
+#define ATTR_quad_bytes0 (6)
+#define UB_vs_params (0)
+#define IMG_image0 (0)
+#define IMG_image1 (1)
+#define IMG_image2 (2)
+#define IMG_image3 (3)
+#define IMG_image4 (4)
+#define IMG_image5 (5)
+#define IMG_image6 (6)
+#define IMG_image7 (7)
+#define IMG_fontPages8 (8)
+#define IMG_atlasPages9 (9)
 #define SMP_default_sampler (0)
+#define SMP_glyph_sampler (1)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct vs_params_t {
+    float world_vp[16];
+    float screen_vp[16];
+} vs_params_t;
+#pragma pack(pop)
 /*
     #version 410
 
-    layout(location = 0) in vec4 position0;
-    layout(location = 0) out vec4 color;
-    layout(location = 1) in vec4 color0;
-    layout(location = 1) out vec2 uv;
-    layout(location = 2) in vec2 uv0;
-    layout(location = 2) out vec4 color_override;
-    layout(location = 3) in vec4 color_override0;
-    layout(location = 3) out vec4 bytes;
-    layout(location = 4) in vec4 bytes0;
+    uniform vec4 vs_params[8];
+    layout(location = 6) in vec4 bytes0;
+    layout(location = 0) in vec2 corner0;
+    layout(location = 2) in vec4 size_scale0;
+    layout(location = 3) in vec2 rot_depth0;
+    layout(location = 1) in vec2 pos0;
+    layout(location = 0) out vec2 uv;
+    layout(location = 4) in vec4 uv_rect0;
+    layout(location = 1) out vec4 color_override;
+    layout(location = 5) in vec4 color_override0;
+    layout(location = 2) out vec4 bytes;
 
     void main()
     {
-        gl_Position = position0;
-        color = color0;
-        uv = uv0;
+        float pivot_index = floor((bytes0.z * 255.0) + 0.5);
+        float pivot_x = floor((pivot_index + 0.5) / 3.0);
+        vec2 pivot = vec2(pivot_x, pivot_index - (pivot_x * 3.0)) * 0.5;
+        vec2 quad_pos = (corner0 - pivot) * size_scale0.xy;
+        float rotation = rot_depth0.x * 3.1415927410125732421875;
+        float sin_r = sin(rotation);
+        float cos_r = cos(rotation);
+        vec2 world_pos = pos0 + (vec2((cos_r * quad_pos.x) - (sin_r * quad_pos.y), (sin_r * quad_pos.x) + (cos_r * quad_pos.y)) * size_scale0.zw);
+        mat4 vp = mat4(vs_params[0], vs_params[1], vs_params[2], vs_params[3]);
+        if (bytes0.y > 0.5)
+        {
+            vp = mat4(vs_params[4], vs_params[5], vs_params[6], vs_params[7]);
+        }
+        gl_Position = vp * vec4(world_pos, rot_depth0.y, 1.0);
+        uv = mix(uv_rect0.xy, uv_rect0.zw, corner0);
         color_override = color_override0;
         bytes = bytes0;
     }
 
 */
-static const uint8_t vs_source_glsl410[502] = {
-    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x6c,0x61,
+static const uint8_t vs_source_glsl410[1315] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x36,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x6c,0x61,
     0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
-    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
-    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
-    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,
-    0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,
-    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
-    0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,
-    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
-    0x76,0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
-    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,
-    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,
-    0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x3b,0x0a,
-    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
-    0x3d,0x20,0x33,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x79,
-    0x74,0x65,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
-    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
-    0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
-    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
-    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,
-    0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,
-    0x20,0x3d,0x20,0x75,0x76,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,
-    0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x63,0x6f,0x6c,
-    0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,
-    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,
+    0x72,0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x73,0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x30,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x72,0x6f,0x74,0x5f,0x64,
+    0x65,0x70,0x74,0x68,0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x70,0x6f,0x73,0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,
+    0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x35,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x32,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x79,0x74,
+    0x65,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x69,0x76,
+    0x6f,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,
+    0x28,0x28,0x62,0x79,0x74,0x65,0x73,0x30,0x2e,0x7a,0x20,0x2a,0x20,0x32,0x35,0x35,
+    0x2e,0x30,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x69,0x76,0x6f,0x74,0x5f,0x78,0x20,0x3d,0x20,
+    0x66,0x6c,0x6f,0x6f,0x72,0x28,0x28,0x70,0x69,0x76,0x6f,0x74,0x5f,0x69,0x6e,0x64,
+    0x65,0x78,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x20,0x2f,0x20,0x33,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x69,0x76,0x6f,0x74,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x70,0x69,0x76,0x6f,0x74,0x5f,0x78,0x2c,
+    0x20,0x70,0x69,0x76,0x6f,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x2d,0x20,0x28,
+    0x70,0x69,0x76,0x6f,0x74,0x5f,0x78,0x20,0x2a,0x20,0x33,0x2e,0x30,0x29,0x29,0x20,
+    0x2a,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x30,0x20,0x2d,0x20,0x70,0x69,0x76,0x6f,0x74,0x29,0x20,0x2a,0x20,0x73,
+    0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x30,0x2e,0x78,0x79,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x2e,0x78,
+    0x20,0x2a,0x20,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,
+    0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x69,0x6e,0x5f,0x72,0x20,0x3d,0x20,0x73,
+    0x69,0x6e,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,0x73,0x5f,0x72,0x20,0x3d,0x20,
+    0x63,0x6f,0x73,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,
+    0x73,0x20,0x3d,0x20,0x70,0x6f,0x73,0x30,0x20,0x2b,0x20,0x28,0x76,0x65,0x63,0x32,
+    0x28,0x28,0x63,0x6f,0x73,0x5f,0x72,0x20,0x2a,0x20,0x71,0x75,0x61,0x64,0x5f,0x70,
+    0x6f,0x73,0x2e,0x78,0x29,0x20,0x2d,0x20,0x28,0x73,0x69,0x6e,0x5f,0x72,0x20,0x2a,
+    0x20,0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x2e,0x79,0x29,0x2c,0x20,0x28,0x73,
+    0x69,0x6e,0x5f,0x72,0x20,0x2a,0x20,0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x2e,
+    0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x6f,0x73,0x5f,0x72,0x20,0x2a,0x20,0x71,0x75,
+    0x61,0x64,0x5f,0x70,0x6f,0x73,0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,0x73,0x69,0x7a,
+    0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x30,0x2e,0x7a,0x77,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6d,0x61,0x74,0x34,0x20,0x76,0x70,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,
+    0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x62,0x79,0x74,0x65,0x73,0x30,0x2e,0x79,0x20,0x3e,0x20,0x30,0x2e,0x35,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x76,0x70,0x20,0x3d,0x20,0x6d,0x61,0x74,0x34,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x35,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x36,0x5d,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x70,0x20,0x2a,0x20,
+    0x76,0x65,0x63,0x34,0x28,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x2c,0x20,
+    0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x2e,0x79,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,
+    0x28,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x2e,0x78,0x79,0x2c,0x20,0x75,0x76,
+    0x5f,0x72,0x65,0x63,0x74,0x30,0x2e,0x7a,0x77,0x2c,0x20,0x63,0x6f,0x72,0x6e,0x65,
+    0x72,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
+    0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x00,
 };
 /*
     #version 410
 
-    uniform sampler2D texture0_default_sampler;
-    uniform sampler2D fontTex1_default_sampler;
+    uniform sampler2D image0_default_sampler;
+    uniform sampler2D image1_default_sampler;
+    uniform sampler2D image2_default_sampler;
+    uniform sampler2D image3_default_sampler;
+    uniform sampler2D image4_default_sampler;
+    uniform sampler2D image5_default_sampler;
+    uniform sampler2D image6_default_sampler;
+    uniform sampler2D image7_default_sampler;
+    uniform sampler2DArray fontPages8_default_sampler;
+    uniform sampler2DArray atlasPages9_default_sampler;
+    uniform sampler2DArray fontPages8_glyph_sampler;
 
-    layout(location = 3) in vec4 bytes;
-    layout(location = 1) in vec2 uv;
+    layout(location = 2) in vec4 bytes;
+    layout(location = 0) in vec2 uv;
     layout(location = 0) out vec4 col_out;
-    layout(location = 0) in vec4 color;
-    layout(location = 2) in vec4 color_override;
+    layout(location = 1) in vec4 color_override;
 
     void main()
     {
-        int _20 = int(bytes.x * 255.0);
+        int _22 = int((bytes.x * 255.0) + 0.5);
+        int _26 = _22 & 127;
+        float _33 = floor((bytes.w * 255.0) + 0.5);
         vec4 tex_col = vec4(1.0);
-        if (_20 == 0)
+        if (_26 == 0)
         {
-            tex_col = texture(texture0_default_sampler, uv);
+            int _48 = int(_33);
+            if (_48 == 0)
+            {
+                tex_col = texture(image0_default_sampler, uv);
+            }
+            else
+            {
+                if (_48 == 1)
+                {
+                    tex_col = texture(image1_default_sampler, uv);
+                }
+                else
+                {
+                    if (_48 == 2)
+                    {
+                        tex_col = texture(image2_default_sampler, uv);
+                    }
+                    else
+                    {
+                        if (_48 == 3)
+                        {
+                            tex_col = texture(image3_default_sampler, uv);
+                        }
+                        else
+                        {
+                            if (_48 == 4)
+                            {
+                                tex_col = texture(image4_default_sampler, uv);
+                            }
+                            else
+                            {
+                                if (_48 == 5)
+                                {
+                                    tex_col = texture(image5_default_sampler, uv);
+                                }
+                                else
+                                {
+                                    if (_48 == 6)
+                                    {
+                                        tex_col = texture(image6_default_sampler, uv);
+                                    }
+                                    else
+                                    {
+                                        if (_48 == 7)
+                                        {
+                                            tex_col = texture(image7_default_sampler, uv);
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
         }
         else
         {
-            if (_20 == 1)
+            if (_26 == 1)
             {
-                tex_col = texture(fontTex1_default_sampler, uv);
+                tex_col = texture(fontPages8_default_sampler, vec3(uv, _33));
+            }
+            else
+            {
+                if (_26 == 2)
+                {
+                    tex_col = texture(atlasPages9_default_sampler, vec3(uv, _33));
+                }
+                else
+                {
+                    if (_26 == 3)
+                    {
+                        float _80 = texture(fontPages8_glyph_sampler, vec3(uv, _33)).w;
+                        float _84 = fwidth(_80);
+                        tex_col = vec4(1.0, 1.0, 1.0, smoothstep(0.5 - _84, 0.5 + _84, _80));
+                    }
+                }
             }
         }
+        bool _88;
+        if (_22 >= 128)
+        {
+            _88 = tex_col.w < 0.5;
+        }
+        else
+        {
+            _88 = false;
+        }
+        if (_88)
+        {
+            discard;
+        }
         col_out = tex_col;
-        col_out *= color;
-        vec4 _66 = col_out;
-        vec3 _75 = mix(_66.xyz, color_override.xyz, vec3(color_override.w));
-        col_out.x = _75.x;
-        col_out.y = _75.y;
-        col_out.z = _75.z;
+        vec4 _99 = col_out;
+        vec3 _107 = mix(_99.xyz, color_override.xyz, vec3(color_override.w));
+        col_out.x = _107.x;
+        col_out.y = _107.y;
+        col_out.z = _107.z;
     }
 
 */
-static const uint8_t fs_source_glsl410[799] = {
+static const uint8_t fs_source_glsl410[3606] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
     0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
-    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
+    0x69,0x6d,0x61,0x67,0x65,0x30,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x6d,0x61,0x67,0x65,0x31,
+    0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x69,0x6d,0x61,0x67,0x65,0x32,0x5f,0x64,0x65,0x66,0x61,0x75,
+    0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x6d,
+    0x61,0x67,0x65,0x33,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x6d,0x61,0x67,0x65,0x34,0x5f,0x64,
+    0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x69,0x6d,0x61,0x67,0x65,0x35,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
     0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,
-    0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x66,0x6f,0x6e,0x74,
-    0x54,0x65,0x78,0x31,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,
+    0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x6d,0x61,0x67,
+    0x65,0x36,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x32,0x44,0x20,0x69,0x6d,0x61,0x67,0x65,0x37,0x5f,0x64,0x65,0x66,
+    0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x41,
+    0x72,0x72,0x61,0x79,0x20,0x66,0x6f,0x6e,0x74,0x50,0x61,0x67,0x65,0x73,0x38,0x5f,
+    0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x32,0x44,0x41,0x72,0x72,0x61,0x79,0x20,0x61,0x74,0x6c,0x61,0x73,0x50,0x61,0x67,
+    0x65,0x73,0x39,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x41,0x72,0x72,0x61,0x79,0x20,0x66,0x6f,0x6e,0x74,
+    0x50,0x61,0x67,0x65,0x73,0x38,0x5f,0x67,0x6c,0x79,0x70,0x68,0x5f,0x73,0x61,0x6d,
     0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,
     0x65,0x63,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
-    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
     0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
     0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
     0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,
     0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,
-    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,
-    0x64,0x65,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x30,0x20,0x3d,
-    0x20,0x69,0x6e,0x74,0x28,0x62,0x79,0x74,0x65,0x73,0x2e,0x78,0x20,0x2a,0x20,0x32,
-    0x35,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
-    0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x31,
-    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x30,
-    0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,
-    0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,
-    0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x30,0x20,0x3d,0x3d,0x20,0x31,0x29,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,
-    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x66,0x6f,0x6e,0x74,0x54,0x65,0x78,
-    0x31,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,
-    0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x5f,
-    0x6f,0x75,0x74,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x2a,0x3d,0x20,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x36,
-    0x36,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x37,0x35,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,
-    0x5f,0x36,0x36,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
-    0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x76,0x65,0x63,
-    0x33,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,
-    0x2e,0x77,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,
-    0x74,0x2e,0x78,0x20,0x3d,0x20,0x5f,0x37,0x35,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x79,0x20,0x3d,0x20,0x5f,0x37,0x35,
-    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,
-    0x7a,0x20,0x3d,0x20,0x5f,0x37,0x35,0x2e,0x7a,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x3b,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,
+    0x28,0x28,0x62,0x79,0x74,0x65,0x73,0x2e,0x78,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,
+    0x30,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x32,0x36,0x20,0x3d,0x20,0x5f,0x32,0x32,0x20,0x26,0x20,0x31,
+    0x32,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,
+    0x33,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x28,0x62,0x79,0x74,0x65,0x73,
+    0x2e,0x77,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,0x20,0x2b,0x20,0x30,0x2e,
+    0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x65,0x78,
+    0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x36,0x20,0x3d,0x3d,
+    0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x38,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,
+    0x5f,0x33,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x69,0x6d,0x61,0x67,0x65,0x30,0x5f,0x64,0x65,0x66,0x61,0x75,
+    0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x6d,0x61,0x67,
+    0x65,0x31,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,
+    0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x6d,0x61,0x67,
+    0x65,0x32,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,
+    0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x69,0x6d,0x61,0x67,0x65,0x33,0x5f,0x64,0x65,0x66,0x61,0x75,
+    0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x69,0x6d,0x61,0x67,0x65,0x34,0x5f,0x64,0x65,0x66,0x61,0x75,
+    0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x6d,0x61,0x67,
+    0x65,0x35,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,
+    0x20,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x69,0x6d,0x61,0x67,
+    0x65,0x36,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,
+    0x20,0x37,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x69,0x6d,0x61,0x67,0x65,0x37,0x5f,0x64,0x65,0x66,0x61,0x75,
+    0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x5f,0x32,0x36,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x66,0x6f,0x6e,0x74,0x50,0x61,0x67,0x65,0x73,0x38,0x5f,0x64,
+    0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,
+    0x76,0x65,0x63,0x33,0x28,0x75,0x76,0x2c,0x20,0x5f,0x33,0x33,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x5f,0x32,0x36,0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x61,0x74,0x6c,0x61,0x73,
+    0x50,0x61,0x67,0x65,0x73,0x39,0x5f,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x75,0x76,0x2c,
+    0x20,0x5f,0x33,0x33,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x36,0x20,0x3d,0x3d,0x20,
+    0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x38,0x30,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x66,0x6f,0x6e,
+    0x74,0x50,0x61,0x67,0x65,0x73,0x38,0x5f,0x67,0x6c,0x79,0x70,0x68,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x75,0x76,0x2c,0x20,
+    0x5f,0x33,0x33,0x29,0x29,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,
+    0x5f,0x38,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,
+    0x65,0x70,0x28,0x30,0x2e,0x35,0x20,0x2d,0x20,0x5f,0x38,0x34,0x2c,0x20,0x30,0x2e,
+    0x35,0x20,0x2b,0x20,0x5f,0x38,0x34,0x2c,0x20,0x5f,0x38,0x30,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x38,0x38,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x32,0x20,0x3e,0x3d,0x20,0x31,0x32,0x38,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x38,0x38,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x2e,0x77,0x20,
+    0x3c,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x5f,0x38,0x38,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x38,0x38,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x5f,0x39,0x39,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x30,0x37,0x20,0x3d,0x20,
+    0x6d,0x69,0x78,0x28,0x5f,0x39,0x39,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x2e,0x78,0x79,0x7a,0x2c,
+    0x20,0x76,0x65,0x63,0x33,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,
+    0x72,0x69,0x64,0x65,0x2e,0x77,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x78,0x20,0x3d,0x20,0x5f,0x31,0x30,0x37,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x79,0x20,
+    0x3d,0x20,0x5f,0x31,0x30,0x37,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x7a,0x20,0x3d,0x20,0x5f,0x31,0x30,0x37,0x2e,0x7a,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
+    cbuffer vs_params : register(b0)
+    {
+        row_major float4x4 _87_world_vp : packoffset(c0);
+        row_major float4x4 _87_screen_vp : packoffset(c4);
+    };
+
+
     static float4 gl_Position;
-    static float4 position0;
-    static float4 color;
-    static float4 color0;
+    static float4 bytes0;
+    static float2 corner0;
+    static float4 size_scale0;
+    static float2 rot_depth0;
+    static float2 pos0;
     static float2 uv;
-    static float2 uv0;
+    static float4 uv_rect0;
     static float4 color_override;
     static float4 color_override0;
     static float4 bytes;
-    static float4 bytes0;
 
     struct SPIRV_Cross_Input
     {
-        float4 position0 : TEXCOORD0;
-        float4 color0 : TEXCOORD1;
-        float2 uv0 : TEXCOORD2;
-        float4 color_override0 : TEXCOORD3;
-        float4 bytes0 : TEXCOORD4;
+        float2 corner0 : TEXCOORD0;
+        float2 pos0 : TEXCOORD1;
+        float4 size_scale0 : TEXCOORD2;
+        float2 rot_depth0 : TEXCOORD3;
+        float4 uv_rect0 : TEXCOORD4;
+        float4 color_override0 : TEXCOORD5;
+        float4 bytes0 : TEXCOORD6;
     };
 
     struct SPIRV_Cross_Output
     {
-        float4 color : TEXCOORD0;
-        float2 uv : TEXCOORD1;
-        float4 color_override : TEXCOORD2;
-        float4 bytes : TEXCOORD3;
+        float2 uv : TEXCOORD0;
+        float4 color_override : TEXCOORD1;
+        float4 bytes : TEXCOORD2;
         float4 gl_Position : SV_Position;
     };
 
     void vert_main()
     {
-        gl_Position = position0;
-        color = color0;
-        uv = uv0;
+        float pivot_index = floor((bytes0.z * 255.0f) + 0.5f);
+        float pivot_x = floor((pivot_index + 0.5f) / 3.0f);
+        float2 pivot = float2(pivot_x, pivot_index - (pivot_x * 3.0f)) * 0.5f;
+        float2 quad_pos = (corner0 - pivot) * size_scale0.xy;
+        float rotation = rot_depth0.x * 3.1415927410125732421875f;
+        float sin_r = sin(rotation);
+        float cos_r = cos(rotation);
+        float2 world_pos = pos0 + (float2((cos_r * quad_pos.x) - (sin_r * quad_pos.y), (sin_r * quad_pos.x) + (cos_r * quad_pos.y)) * size_scale0.zw);
+        float4x4 vp = _87_world_vp;
+        if (bytes0.y > 0.5f)
+        {
+            vp = _87_screen_vp;
+        }
+        gl_Position = mul(float4(world_pos, rot_depth0.y, 1.0f), vp);
+        uv = lerp(uv_rect0.xy, uv_rect0.zw, corner0);
         color_override = color_override0;
         bytes = bytes0;
     }
 
     SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
     {
-        position0 = stage_input.position0;
-        color0 = stage_input.color0;
-        uv0 = stage_input.uv0;
-        color_override0 = stage_input.color_override0;
         bytes0 = stage_input.bytes0;
+        corner0 = stage_input.corner0;
+        size_scale0 = stage_input.size_scale0;
+        rot_depth0 = stage_input.rot_depth0;
+        pos0 = stage_input.pos0;
+        uv_rect0 = stage_input.uv_rect0;
+        color_override0 = stage_input.color_override0;
         vert_main();
         SPIRV_Cross_Output stage_output;
         stage_output.gl_Position = gl_Position;
-        stage_output.color = color;
         stage_output.uv = uv;
         stage_output.color_override = color_override;
         stage_output.bytes = bytes;
         return stage_output;
     }
 */
-static const uint8_t vs_source_hlsl5[1277] = {
-    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
-    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
-    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x30,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x73,
-    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,
-    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
-    0x76,0x30,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,
-    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x3b,
-    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,
-    0x79,0x74,0x65,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x0a,0x73,0x74,0x72,
-    0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,
-    0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x30,0x20,0x3a,0x20,0x54,
-    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3a,0x20,0x54,0x45,
-    0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x32,0x20,0x75,0x76,0x30,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
-    0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x20,
-    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x20,0x3a,
-    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
-    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
-    0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,
-    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+static const uint8_t vs_source_hlsl5[2229] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,0x5f,0x6d,0x61,0x6a,0x6f,0x72,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x5f,0x38,0x37,0x5f,0x77,0x6f,
+    0x72,0x6c,0x64,0x5f,0x76,0x70,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x77,
+    0x5f,0x6d,0x61,0x6a,0x6f,0x72,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,
+    0x5f,0x38,0x37,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x76,0x70,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,
+    0x74,0x65,0x73,0x30,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x30,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x69,0x7a,0x65,0x5f,
+    0x73,0x63,0x61,0x6c,0x65,0x30,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x6f,0x73,0x30,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x3b,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x30,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,0x30,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,
+    0x30,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x72,0x6f,0x74,0x5f,0x64,0x65,
+    0x70,0x74,0x68,0x30,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x76,0x5f,
+    0x72,0x65,0x63,0x74,0x30,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x36,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
     0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
-    0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
     0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3a,
-    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
     0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x3a,0x20,0x54,
-    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
     0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
     0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,
     0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,
-    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,
-    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
-    0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,
-    0x20,0x75,0x76,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
-    0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,
-    0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x62,0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,
-    0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
-    0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,
-    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x30,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3d,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,
-    0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x73,0x74,
-    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x75,0x76,0x30,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,
-    0x65,0x30,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x20,0x3d,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x62,0x79,0x74,0x65,0x73,
-    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,
-    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
-    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
-    0x75,0x74,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
-    0x75,0x74,0x70,0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
-    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,
-    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x3b,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x69,0x76,0x6f,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x6f,0x72,0x28,0x28,0x62,0x79,0x74,0x65,0x73,0x30,0x2e,0x7a,0x20,0x2a,
+    0x20,0x32,0x35,0x35,0x2e,0x30,0x66,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x69,0x76,0x6f,
+    0x74,0x5f,0x78,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x28,0x70,0x69,0x76,
+    0x6f,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,
+    0x20,0x2f,0x20,0x33,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x70,0x69,0x76,0x6f,0x74,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x28,0x70,0x69,0x76,0x6f,0x74,0x5f,0x78,0x2c,0x20,0x70,0x69,0x76,
+    0x6f,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x2d,0x20,0x28,0x70,0x69,0x76,0x6f,
+    0x74,0x5f,0x78,0x20,0x2a,0x20,0x33,0x2e,0x30,0x66,0x29,0x29,0x20,0x2a,0x20,0x30,
+    0x2e,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x30,0x20,0x2d,0x20,0x70,0x69,0x76,0x6f,0x74,0x29,0x20,0x2a,0x20,0x73,
+    0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x30,0x2e,0x78,0x79,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x2e,0x78,
+    0x20,0x2a,0x20,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,
+    0x32,0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x66,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x69,0x6e,0x5f,0x72,0x20,0x3d,0x20,
+    0x73,0x69,0x6e,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,0x73,0x5f,0x72,0x20,0x3d,
+    0x20,0x63,0x6f,0x73,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x77,0x6f,0x72,0x6c,0x64,
+    0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x70,0x6f,0x73,0x30,0x20,0x2b,0x20,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x28,0x63,0x6f,0x73,0x5f,0x72,0x20,0x2a,0x20,0x71,
+    0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x2e,0x78,0x29,0x20,0x2d,0x20,0x28,0x73,0x69,
+    0x6e,0x5f,0x72,0x20,0x2a,0x20,0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x2e,0x79,
+    0x29,0x2c,0x20,0x28,0x73,0x69,0x6e,0x5f,0x72,0x20,0x2a,0x20,0x71,0x75,0x61,0x64,
+    0x5f,0x70,0x6f,0x73,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x6f,0x73,0x5f,0x72,
+    0x20,0x2a,0x20,0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x2e,0x79,0x29,0x29,0x20,
+    0x2a,0x20,0x73,0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x30,0x2e,0x7a,0x77,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,
+    0x76,0x70,0x20,0x3d,0x20,0x5f,0x38,0x37,0x5f,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x76,
+    0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x79,0x74,0x65,0x73,
+    0x30,0x2e,0x79,0x20,0x3e,0x20,0x30,0x2e,0x35,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x70,0x20,0x3d,0x20,0x5f,
+    0x38,0x37,0x5f,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x76,0x70,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x28,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x72,0x6f,0x74,0x5f,
+    0x64,0x65,0x70,0x74,0x68,0x30,0x2e,0x79,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x2c,
+    0x20,0x76,0x70,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x6c,
+    0x65,0x72,0x70,0x28,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x2e,0x78,0x79,0x2c,
+    0x20,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x2e,0x7a,0x77,0x2c,0x20,0x63,0x6f,
+    0x72,0x6e,0x65,0x72,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x30,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x72,0x6e,0x65,0x72,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,
+    0x30,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x73,0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x20,0x3d,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x72,0x6f,0x74,0x5f,0x64,0x65,
+    0x70,0x74,0x68,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x30,0x20,0x3d,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x75,0x76,
+    0x5f,0x72,0x65,0x63,0x74,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x20,0x3d,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,
     0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
-    0x74,0x2e,0x62,0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x75,0x76,
+    0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,
+    0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
+    0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x62,0x79,0x74,0x65,0x73,0x20,
+    0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
-    Texture2D<float4> texture0 : register(t0);
+    Texture2D<float4> image0 : register(t0);
     SamplerState default_sampler : register(s0);
-    Texture2D<float4> fontTex1 : register(t1);
+    Texture2D<float4> image1 : register(t1);
+    Texture2D<float4> image2 : register(t2);
+    Texture2D<float4> image3 : register(t3);
+    Texture2D<float4> image4 : register(t4);
+    Texture2D<float4> image5 : register(t5);
+    Texture2D<float4> image6 : register(t6);
+    Texture2D<float4> image7 : register(t7);
+    Texture2DArray<float4> fontPages8 : register(t8);
+    Texture2DArray<float4> atlasPages9 : register(t9);
+    SamplerState glyph_sampler : register(s1);
 
     static float4 bytes;
     static float2 uv;
     static float4 col_out;
-    static float4 color;
     static float4 color_override;
 
     struct SPIRV_Cross_Input
     {
-        float4 color : TEXCOORD0;
-        float2 uv : TEXCOORD1;
-        float4 color_override : TEXCOORD2;
-        float4 bytes : TEXCOORD3;
+        float2 uv : TEXCOORD0;
+        float4 color_override : TEXCOORD1;
+        float4 bytes : TEXCOORD2;
     };
 
     struct SPIRV_Cross_Output
@@ -362,33 +848,115 @@ static const uint8_t vs_source_hlsl5[1277] = {
 
     void frag_main()
     {
-        int _20 = int(bytes.x * 255.0f);
+        int _22 = int((bytes.x * 255.0f) + 0.5f);
+        int _26 = _22 & 127;
+        float _33 = floor((bytes.w * 255.0f) + 0.5f);
         float4 tex_col = 1.0f.xxxx;
-        if (_20 == 0)
+        if (_26 == 0)
         {
-            tex_col = texture0.Sample(default_sampler, uv);
+            int _48 = int(_33);
+            if (_48 == 0)
+            {
+                tex_col = image0.Sample(default_sampler, uv);
+            }
+            else
+            {
+                if (_48 == 1)
+                {
+                    tex_col = image1.Sample(default_sampler, uv);
+                }
+                else
+                {
+                    if (_48 == 2)
+                    {
+                        tex_col = image2.Sample(default_sampler, uv);
+                    }
+                    else
+                    {
+                        if (_48 == 3)
+                        {
+                            tex_col = image3.Sample(default_sampler, uv);
+                        }
+                        else
+                        {
+                            if (_48 == 4)
+                            {
+                                tex_col = image4.Sample(default_sampler, uv);
+                            }
+                            else
+                            {
+                                if (_48 == 5)
+                                {
+                                    tex_col = image5.Sample(default_sampler, uv);
+                                }
+                                else
+                                {
+                                    if (_48 == 6)
+                                    {
+                                        tex_col = image6.Sample(default_sampler, uv);
+                                    }
+                                    else
+                                    {
+                                        if (_48 == 7)
+                                        {
+                                            tex_col = image7.Sample(default_sampler, uv);
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
         }
         else
         {
-            if (_20 == 1)
+            if (_26 == 1)
             {
-                tex_col = fontTex1.Sample(default_sampler, uv);
+                tex_col = fontPages8.Sample(default_sampler, float3(uv, _33));
             }
+            else
+            {
+                if (_26 == 2)
+                {
+                    tex_col = atlasPages9.Sample(default_sampler, float3(uv, _33));
+                }
+                else
+                {
+                    if (_26 == 3)
+                    {
+                        float _80 = fontPages8.Sample(glyph_sampler, float3(uv, _33)).w;
+                        float _84 = fwidth(_80);
+                        tex_col = float4(1.0f, 1.0f, 1.0f, smoothstep(0.5f - _84, 0.5f + _84, _80));
+                    }
+                }
+            }
+        }
+        bool _88;
+        if (_22 >= 128)
+        {
+            _88 = tex_col.w < 0.5f;
+        }
+        else
+        {
+            _88 = false;
+        }
+        if (_88)
+        {
+            discard;
         }
         col_out = tex_col;
-        col_out *= color;
-        float4 _66 = col_out;
-        float3 _75 = lerp(_66.xyz, color_override.xyz, color_override.w.xxx);
-        col_out.x = _75.x;
-        col_out.y = _75.y;
-        col_out.z = _75.z;
+        float4 _99 = col_out;
+        float3 _107 = lerp(_99.xyz, color_override.xyz, color_override.w.xxx);
+        col_out.x = _107.x;
+        col_out.y = _107.y;
+        col_out.z = _107.z;
     }
 
     SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
     {
         bytes = stage_input.bytes;
         uv = stage_input.uv;
-        color = stage_input.color;
         color_override = stage_input.color_override;
         frag_main();
         SPIRV_Cross_Output stage_output;
@@ -396,88 +964,261 @@ static const uint8_t vs_source_hlsl5[1277] = {
         return stage_output;
     }
 */
-static const uint8_t fs_source_hlsl5[1293] = {
+static const uint8_t fs_source_hlsl5[4048] = {
     0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x3e,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,
-    0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,
-    0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,
-    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
-    0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,
-    0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x66,0x6f,0x6e,0x74,0x54,0x65,
-    0x78,0x31,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,
-    0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
-    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,
-    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,
-    0x69,0x64,0x65,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,
-    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,
-    0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,
-    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,
-    0x69,0x64,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,
-    0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x7d,
+    0x3e,0x20,0x69,0x6d,0x61,0x67,0x65,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x53,0x74,0x61,0x74,0x65,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x73,0x30,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x69,0x6d,0x61,0x67,0x65,0x31,0x20,0x3a,
+    0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,0x29,0x3b,0x0a,0x54,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,
+    0x20,0x69,0x6d,0x61,0x67,0x65,0x32,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x74,0x32,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,
+    0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x69,0x6d,0x61,0x67,0x65,0x33,
+    0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x33,0x29,0x3b,
+    0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x3e,0x20,0x69,0x6d,0x61,0x67,0x65,0x34,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x74,0x34,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x69,0x6d,0x61,0x67,
+    0x65,0x35,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x35,
+    0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x3e,0x20,0x69,0x6d,0x61,0x67,0x65,0x36,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x36,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x69,0x6d,
+    0x61,0x67,0x65,0x37,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,
+    0x74,0x37,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x41,0x72,
+    0x72,0x61,0x79,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x66,0x6f,0x6e,0x74,
+    0x50,0x61,0x67,0x65,0x73,0x38,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,
+    0x72,0x28,0x74,0x38,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,
+    0x41,0x72,0x72,0x61,0x79,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x61,0x74,
+    0x6c,0x61,0x73,0x50,0x61,0x67,0x65,0x73,0x39,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x74,0x39,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x67,0x6c,0x79,0x70,0x68,0x5f,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,
+    0x73,0x31,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x5f,0x6f,
+    0x75,0x74,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,
     0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,
-    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,
-    0x74,0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,
-    0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,
-    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,
-    0x32,0x30,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x62,0x79,0x74,0x65,0x73,0x2e,0x78,
-    0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,
-    0x20,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x5f,0x32,0x30,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,
-    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x2e,0x53,
-    0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,
-    0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x30,
-    0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,
-    0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x66,0x6f,0x6e,0x74,0x54,0x65,0x78,0x31,0x2e,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,
+    0x64,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,
+    0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,
+    0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x28,0x62,0x79,0x74,0x65,0x73,0x2e,0x78,
+    0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x66,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x20,
+    0x3d,0x20,0x5f,0x32,0x32,0x20,0x26,0x20,0x31,0x32,0x37,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x33,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x6f,0x72,0x28,0x28,0x62,0x79,0x74,0x65,0x73,0x2e,0x77,0x20,0x2a,0x20,0x32,0x35,
+    0x35,0x2e,0x30,0x66,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x36,0x20,0x3d,0x3d,0x20,0x30,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x34,0x38,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x5f,0x33,0x33,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x34,0x38,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,0x30,0x2e,
     0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,
     0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x63,
-    0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,
-    0x2a,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x5f,0x36,0x36,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6f,
-    0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
-    0x37,0x35,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,0x5f,0x36,0x36,0x2e,0x78,0x79,
-    0x7a,0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,
-    0x65,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,
-    0x72,0x72,0x69,0x64,0x65,0x2e,0x77,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x78,0x20,0x3d,0x20,0x5f,0x37,
-    0x35,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,
-    0x2e,0x79,0x20,0x3d,0x20,0x5f,0x37,0x35,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x7a,0x20,0x3d,0x20,0x5f,0x37,0x35,0x2e,
-    0x7a,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
-    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,
-    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x62,0x79,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
-    0x75,0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,
-    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,
-    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
-    0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,
-    0x72,0x72,0x69,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,
-    0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,
-    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x63,0x6f,
-    0x6c,0x5f,0x6f,0x75,0x74,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,
+    0x38,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,
+    0x69,0x6d,0x61,0x67,0x65,0x31,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,
+    0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,
+    0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,
+    0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,
+    0x6d,0x61,0x67,0x65,0x32,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,
+    0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,
+    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,0x33,0x2e,0x53,0x61,0x6d,
+    0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,
+    0x3d,0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,
+    0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,0x34,0x2e,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,
+    0x20,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6d,0x61,0x67,
+    0x65,0x35,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,
+    0x36,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,
+    0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,0x37,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,
+    0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,
+    0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x36,0x20,0x3d,0x3d,0x20,0x31,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,
+    0x20,0x66,0x6f,0x6e,0x74,0x50,0x61,0x67,0x65,0x73,0x38,0x2e,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x75,0x76,0x2c,0x20,0x5f,
+    0x33,0x33,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x36,0x20,0x3d,0x3d,0x20,0x32,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x61,0x74,0x6c,0x61,0x73,0x50,0x61,
+    0x67,0x65,0x73,0x39,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,
+    0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x28,0x75,0x76,0x2c,0x20,0x5f,0x33,0x33,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x5f,0x32,0x36,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x6f,0x6e,0x74,
+    0x50,0x61,0x67,0x65,0x73,0x38,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x67,0x6c,
+    0x79,0x70,0x68,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x28,0x75,0x76,0x2c,0x20,0x5f,0x33,0x33,0x29,0x29,0x2e,0x77,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,
+    0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x5f,0x38,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,
+    0x2e,0x30,0x66,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,
+    0x30,0x2e,0x35,0x66,0x20,0x2d,0x20,0x5f,0x38,0x34,0x2c,0x20,0x30,0x2e,0x35,0x66,
+    0x20,0x2b,0x20,0x5f,0x38,0x34,0x2c,0x20,0x5f,0x38,0x30,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x38,0x38,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x32,0x20,0x3e,0x3d,0x20,0x31,0x32,0x38,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
+    0x38,0x38,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x2e,0x77,0x20,0x3c,
+    0x20,0x30,0x2e,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x5f,0x38,0x38,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x38,0x38,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x5f,0x39,0x39,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x30,
+    0x37,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,0x5f,0x39,0x39,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,
+    0x72,0x69,0x64,0x65,0x2e,0x77,0x2e,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x78,0x20,0x3d,0x20,0x5f,0x31,0x30,
+    0x37,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,
+    0x2e,0x79,0x20,0x3d,0x20,0x5f,0x31,0x30,0x37,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x7a,0x20,0x3d,0x20,0x5f,0x31,0x30,
+    0x37,0x2e,0x7a,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,
+    0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x62,0x79,0x74,0x65,0x73,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,
+    0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,
+    0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,
+    0x2e,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6f,
+    0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+
 };
 /*
     #include <metal_stdlib>
@@ -485,84 +1226,155 @@ static const uint8_t fs_source_hlsl5[1293] = {
 
     using namespace metal;
 
+    struct vs_params
+    {
+        float4x4 world_vp;
+        float4x4 screen_vp;
+    };
+
     struct main0_out
     {
-        float4 color [[user(locn0)]];
-        float2 uv [[user(locn1)]];
-        float4 color_override [[user(locn2)]];
-        float4 bytes [[user(locn3)]];
+        float2 uv [[user(locn0)]];
+        float4 color_override [[user(locn1)]];
+        float4 bytes [[user(locn2)]];
         float4 gl_Position [[position]];
     };
 
     struct main0_in
     {
-        float4 position0 [[attribute(0)]];
-        float4 color0 [[attribute(1)]];
-        float2 uv0 [[attribute(2)]];
-        float4 color_override0 [[attribute(3)]];
-        float4 bytes0 [[attribute(4)]];
+        float2 corner0 [[attribute(0)]];
+        float2 pos0 [[attribute(1)]];
+        float4 size_scale0 [[attribute(2)]];
+        float2 rot_depth0 [[attribute(3)]];
+        float4 uv_rect0 [[attribute(4)]];
+        float4 color_override0 [[attribute(5)]];
+        float4 bytes0 [[attribute(6)]];
     };
 
-    vertex main0_out main0(main0_in in [[stage_in]])
+    vertex main0_out main0(main0_in in [[stage_in]], constant vs_params& _87 [[buffer(0)]])
     {
         main0_out out = {};
-        out.gl_Position = in.position0;
-        out.color = in.color0;
-        out.uv = in.uv0;
+        float pivot_index = floor((in.bytes0.z * 255.0) + 0.5);
+        float pivot_x = floor((pivot_index + 0.5) / 3.0);
+        float2 pivot = float2(pivot_x, pivot_index - (pivot_x * 3.0)) * 0.5;
+        float2 quad_pos = (in.corner0 - pivot) * in.size_scale0.xy;
+        float rotation = in.rot_depth0.x * 3.1415927410125732421875;
+        float sin_r = sin(rotation);
+        float cos_r = cos(rotation);
+        float2 world_pos = in.pos0 + (float2((cos_r * quad_pos.x) - (sin_r * quad_pos.y), (sin_r * quad_pos.x) + (cos_r * quad_pos.y)) * in.size_scale0.zw);
+        float4x4 vp = _87.world_vp;
+        if (in.bytes0.y > 0.5)
+        {
+            vp = _87.screen_vp;
+        }
+        out.gl_Position = vp * float4(world_pos, in.rot_depth0.y, 1.0);
+        out.uv = mix(in.uv_rect0.xy, in.uv_rect0.zw, in.corner0);
         out.color_override = in.color_override0;
         out.bytes = in.bytes0;
         return out;
     }
 
 */
-static const uint8_t vs_source_metal_macos[736] = {
+static const uint8_t vs_source_metal_macos[1573] = {
     0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
     0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
     0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
     0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
-    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
-    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,
-    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,
-    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,
-    0x72,0x72,0x69,0x64,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
-    0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
-    0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
-    0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
-    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
-    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,
-    0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x5b,0x5b,0x61,
-    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x30,0x20,0x5b,0x5b,
-    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x76,0x70,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,0x20,0x73,
+    0x63,0x72,0x65,0x65,0x6e,0x5f,0x76,0x70,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
     0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,
-    0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,
-    0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x20,0x5b,
-    0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x34,0x29,0x5d,0x5d,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,
-    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,
-    0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,
-    0x69,0x6e,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,
-    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,
-    0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x75,
-    0x76,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x6f,
-    0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,
-    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x62,0x79,0x74,0x65,0x73,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
-
+    0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,
+    0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,0x30,0x20,0x5b,0x5b,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x69,0x7a,0x65,0x5f,0x73,
+    0x63,0x61,0x6c,0x65,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x76,0x5f,0x72,0x65,
+    0x63,0x74,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,
+    0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x35,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,
+    0x74,0x65,0x73,0x30,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x28,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,
+    0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,
+    0x5f,0x38,0x37,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,
+    0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x69,0x76,0x6f,0x74,0x5f,0x69,0x6e,0x64,
+    0x65,0x78,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x28,0x69,0x6e,0x2e,0x62,
+    0x79,0x74,0x65,0x73,0x30,0x2e,0x7a,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,
+    0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x69,0x76,0x6f,0x74,0x5f,0x78,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x6f,0x72,0x28,0x28,0x70,0x69,0x76,0x6f,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,
+    0x2b,0x20,0x30,0x2e,0x35,0x29,0x20,0x2f,0x20,0x33,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x69,0x76,0x6f,0x74,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x70,0x69,0x76,0x6f,0x74,0x5f,0x78,
+    0x2c,0x20,0x70,0x69,0x76,0x6f,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x2d,0x20,
+    0x28,0x70,0x69,0x76,0x6f,0x74,0x5f,0x78,0x20,0x2a,0x20,0x33,0x2e,0x30,0x29,0x29,
+    0x20,0x2a,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x69,
+    0x6e,0x2e,0x63,0x6f,0x72,0x6e,0x65,0x72,0x30,0x20,0x2d,0x20,0x70,0x69,0x76,0x6f,
+    0x74,0x29,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x73,0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,
+    0x6c,0x65,0x30,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x2e,0x78,0x20,0x2a,0x20,0x33,
+    0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,0x33,
+    0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x73,0x69,0x6e,0x5f,0x72,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x63,0x6f,0x73,0x5f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,
+    0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x30,0x20,0x2b,0x20,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x28,0x28,0x63,0x6f,0x73,0x5f,0x72,0x20,0x2a,0x20,0x71,0x75,0x61,
+    0x64,0x5f,0x70,0x6f,0x73,0x2e,0x78,0x29,0x20,0x2d,0x20,0x28,0x73,0x69,0x6e,0x5f,
+    0x72,0x20,0x2a,0x20,0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x2e,0x79,0x29,0x2c,
+    0x20,0x28,0x73,0x69,0x6e,0x5f,0x72,0x20,0x2a,0x20,0x71,0x75,0x61,0x64,0x5f,0x70,
+    0x6f,0x73,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x6f,0x73,0x5f,0x72,0x20,0x2a,
+    0x20,0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,
+    0x69,0x6e,0x2e,0x73,0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x30,0x2e,0x7a,
+    0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x78,0x34,
+    0x20,0x76,0x70,0x20,0x3d,0x20,0x5f,0x38,0x37,0x2e,0x77,0x6f,0x72,0x6c,0x64,0x5f,
+    0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x2e,0x62,
+    0x79,0x74,0x65,0x73,0x30,0x2e,0x79,0x20,0x3e,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x70,0x20,
+    0x3d,0x20,0x5f,0x38,0x37,0x2e,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x76,0x70,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x70,0x20,
+    0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,
+    0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,
+    0x30,0x2e,0x79,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x69,0x6e,0x2e,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x2e,0x78,0x79,0x2c,0x20,0x69,0x6e,0x2e,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x2e,0x7a,0x77,0x2c,0x20,0x69,0x6e,0x2e,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,
+    0x69,0x64,0x65,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x62,0x79,
+    0x74,0x65,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #include <metal_stdlib>
@@ -577,40 +1389,122 @@ static const uint8_t vs_source_metal_macos[736] = {
 
     struct main0_in
     {
-        float4 color [[user(locn0)]];
-        float2 uv [[user(locn1)]];
-        float4 color_override [[user(locn2)]];
-        float4 bytes [[user(locn3)]];
+        float2 uv [[user(locn0)]];
+        float4 color_override [[user(locn1)]];
+        float4 bytes [[user(locn2)]];
     };
 
-    fragment main0_out main0(main0_in in [[stage_in]], texture2d<float> texture0 [[texture(0)]], texture2d<float> fontTex1 [[texture(1)]], sampler default_sampler [[sampler(0)]])
+    fragment main0_out main0(main0_in in [[stage_in]], texture2d<float> image0 [[texture(0)]], texture2d<float> image1 [[texture(1)]], texture2d<float> image2 [[texture(2)]], texture2d<float> image3 [[texture(3)]], texture2d<float> image4 [[texture(4)]], texture2d<float> image5 [[texture(5)]], texture2d<float> image6 [[texture(6)]], texture2d<float> image7 [[texture(7)]], texture2d_array<float> fontPages8 [[texture(8)]], texture2d_array<float> atlasPages9 [[texture(9)]], sampler default_sampler [[sampler(0)]], sampler glyph_sampler [[sampler(1)]])
     {
         main0_out out = {};
-        int _20 = int(in.bytes.x * 255.0);
+        int _22 = int((in.bytes.x * 255.0) + 0.5);
+        int _26 = _22 & 127;
+        float _33 = floor((in.bytes.w * 255.0) + 0.5);
         float4 tex_col = float4(1.0);
-        if (_20 == 0)
+        if (_26 == 0)
         {
-            tex_col = texture0.sample(default_sampler, in.uv);
+            int _48 = int(_33);
+            if (_48 == 0)
+            {
+                tex_col = image0.sample(default_sampler, in.uv);
+            }
+            else
+            {
+                if (_48 == 1)
+                {
+                    tex_col = image1.sample(default_sampler, in.uv);
+                }
+                else
+                {
+                    if (_48 == 2)
+                    {
+                        tex_col = image2.sample(default_sampler, in.uv);
+                    }
+                    else
+                    {
+                        if (_48 == 3)
+                        {
+                            tex_col = image3.sample(default_sampler, in.uv);
+                        }
+                        else
+                        {
+                            if (_48 == 4)
+                            {
+                                tex_col = image4.sample(default_sampler, in.uv);
+                            }
+                            else
+                            {
+                                if (_48 == 5)
+                                {
+                                    tex_col = image5.sample(default_sampler, in.uv);
+                                }
+                                else
+                                {
+                                    if (_48 == 6)
+                                    {
+                                        tex_col = image6.sample(default_sampler, in.uv);
+                                    }
+                                    else
+                                    {
+                                        if (_48 == 7)
+                                        {
+                                            tex_col = image7.sample(default_sampler, in.uv);
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
         }
         else
         {
-            if (_20 == 1)
+            if (_26 == 1)
             {
-                tex_col = fontTex1.sample(default_sampler, in.uv);
+                tex_col = fontPages8.sample(default_sampler, in.uv, uint(rint(_33)));
             }
+            else
+            {
+                if (_26 == 2)
+                {
+                    tex_col = atlasPages9.sample(default_sampler, in.uv, uint(rint(_33)));
+                }
+                else
+                {
+                    if (_26 == 3)
+                    {
+                        float _80 = fontPages8.sample(glyph_sampler, in.uv, uint(rint(_33))).w;
+                        float _84 = fwidth(_80);
+                        tex_col = float4(1.0, 1.0, 1.0, smoothstep(0.5 - _84, 0.5 + _84, _80));
+                    }
+                }
+            }
+        }
+        bool _88;
+        if (_22 >= 128)
+        {
+            _88 = tex_col.w < 0.5;
+        }
+        else
+        {
+            _88 = false;
+        }
+        if (_88)
+        {
+            discard_fragment();
         }
         out.col_out = tex_col;
-        out.col_out *= in.color;
-        float4 _66 = out.col_out;
-        float3 _75 = mix(_66.xyz, in.color_override.xyz, float3(in.color_override.w));
-        out.col_out.x = _75.x;
-        out.col_out.y = _75.y;
-        out.col_out.z = _75.z;
+        float4 _99 = out.col_out;
+        float3 _107 = mix(_99.xyz, in.color_override.xyz, float3(in.color_override.w));
+        out.col_out.x = _107.x;
+        out.col_out.y = _107.y;
+        out.col_out.z = _107.z;
         return out;
     }
 
 */
-static const uint8_t fs_source_metal_macos[1051] = {
+static const uint8_t fs_source_metal_macos[3880] = {
     0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
     0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
     0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
@@ -620,76 +1514,268 @@ static const uint8_t fs_source_metal_macos[1051] = {
     0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x5b,0x5b,
     0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
     0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,
-    0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
-    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
-    0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,
-    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,
-    0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x5b,0x5b,0x75,
-    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x5b,
-    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,
-    0x7d,0x3b,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,
-    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,
-    0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,
-    0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,
-    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,
-    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,
-    0x3e,0x20,0x66,0x6f,0x6e,0x74,0x54,0x65,0x78,0x31,0x20,0x5b,0x5b,0x74,0x65,0x78,
-    0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,
-    0x65,0x72,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
-    0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,
-    0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
-    0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x30,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x69,
-    0x6e,0x2e,0x62,0x79,0x74,0x65,0x73,0x2e,0x78,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,
-    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,
+    0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,
+    0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x6d,0x61,0x67,0x65,0x30,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x6d,
+    0x61,0x67,0x65,0x31,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x6d,0x61,0x67,0x65,0x32,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x6d,
+    0x61,0x67,0x65,0x33,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x33,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x6d,0x61,0x67,0x65,0x34,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x34,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x6d,
+    0x61,0x67,0x65,0x35,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x35,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x6d,0x61,0x67,0x65,0x36,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x36,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x69,0x6d,
+    0x61,0x67,0x65,0x37,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x37,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,
+    0x72,0x72,0x61,0x79,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x66,0x6f,0x6e,0x74,
+    0x50,0x61,0x67,0x65,0x73,0x38,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,
+    0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x61,0x74,
+    0x6c,0x61,0x73,0x50,0x61,0x67,0x65,0x73,0x39,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x39,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x67,0x6c,0x79,0x70,0x68,0x5f,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x28,0x31,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x32,0x20,0x3d,0x20,
+    0x69,0x6e,0x74,0x28,0x28,0x69,0x6e,0x2e,0x62,0x79,0x74,0x65,0x73,0x2e,0x78,0x20,
+    0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x20,0x3d,0x20,0x5f,
+    0x32,0x32,0x20,0x26,0x20,0x31,0x32,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x33,0x33,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,
+    0x28,0x69,0x6e,0x2e,0x62,0x79,0x74,0x65,0x73,0x2e,0x77,0x20,0x2a,0x20,0x32,0x35,
+    0x35,0x2e,0x30,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x36,0x20,0x3d,0x3d,0x20,0x30,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x34,0x38,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x5f,0x33,0x33,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x34,0x38,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,0x30,0x2e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,
+    0x20,0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,0x31,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,
+    0x3d,0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,
+    0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,0x32,0x2e,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,
+    0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,
+    0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,
+    0x6d,0x61,0x67,0x65,0x33,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,
+    0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x6e,
+    0x2e,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x34,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,
+    0x20,0x69,0x6d,0x61,0x67,0x65,0x34,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,
+    0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,
+    0x69,0x6e,0x2e,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,
+    0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,
+    0x35,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x36,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6d,0x61,
+    0x67,0x65,0x36,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,
+    0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,
+    0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,
+    0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,0x37,0x2e,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x32,0x36,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x66,0x6f,0x6e,0x74,0x50,0x61,0x67,
+    0x65,0x73,0x38,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,
+    0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,
+    0x76,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x5f,0x33,0x33,
+    0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x36,0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,
+    0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x61,0x74,0x6c,0x61,0x73,0x50,0x61,0x67,
+    0x65,0x73,0x39,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,
+    0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,
+    0x76,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x5f,0x33,0x33,
+    0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x36,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x38,0x30,0x20,
+    0x3d,0x20,0x66,0x6f,0x6e,0x74,0x50,0x61,0x67,0x65,0x73,0x38,0x2e,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x28,0x67,0x6c,0x79,0x70,0x68,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,
+    0x69,0x6e,0x74,0x28,0x5f,0x33,0x33,0x29,0x29,0x29,0x2e,0x77,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x66,0x77,
+    0x69,0x64,0x74,0x68,0x28,0x5f,0x38,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
     0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
-    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,
-    0x30,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,
-    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,
-    0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,
-    0x20,0x69,0x6e,0x2e,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x30,0x20,0x3d,0x3d,
-    0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,
-    0x6c,0x20,0x3d,0x20,0x66,0x6f,0x6e,0x74,0x54,0x65,0x78,0x31,0x2e,0x73,0x61,0x6d,
-    0x70,0x6c,0x65,0x28,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,
-    0x6c,0x65,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x3d,0x20,0x74,
-    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
-    0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x2a,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x5f,0x36,0x36,0x20,0x3d,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x5f,0x6f,0x75,
-    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x37,
-    0x35,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x5f,0x36,0x36,0x2e,0x78,0x79,0x7a,0x2c,
-    0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,
-    0x64,0x65,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,
-    0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,
-    0x2e,0x77,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,
-    0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x78,0x20,0x3d,0x20,0x5f,0x37,0x35,0x2e,0x78,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,
-    0x2e,0x79,0x20,0x3d,0x20,0x5f,0x37,0x35,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x7a,0x20,0x3d,0x20,
-    0x5f,0x37,0x35,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
-    0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x73,
+    0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x35,0x20,0x2d,0x20,
+    0x5f,0x38,0x34,0x2c,0x20,0x30,0x2e,0x35,0x20,0x2b,0x20,0x5f,0x38,0x34,0x2c,0x20,
+    0x5f,0x38,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,
+    0x5f,0x38,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x32,
+    0x20,0x3e,0x3d,0x20,0x31,0x32,0x38,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x38,0x38,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x5f,0x63,0x6f,0x6c,0x2e,0x77,0x20,0x3c,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x38,0x38,0x20,0x3d,
+    0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x38,0x38,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,
+    0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x5f,0x6f,
+    0x75,0x74,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x39,0x39,0x20,0x3d,0x20,0x6f,
+    0x75,0x74,0x2e,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x30,0x37,0x20,0x3d,0x20,0x6d,0x69,
+    0x78,0x28,0x5f,0x39,0x39,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x69,0x6e,0x2e,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x2e,0x77,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,
+    0x78,0x20,0x3d,0x20,0x5f,0x31,0x30,0x37,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x79,0x20,0x3d,0x20,
+    0x5f,0x31,0x30,0x37,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x7a,0x20,0x3d,0x20,0x5f,0x31,0x30,0x37,
+    0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,
+    0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     diagnostic(off, derivative_uniformity);
 
-    var<private> position0 : vec4f;
+    struct vs_params {
+      /_ @offset(0) _/
+      world_vp : mat4x4f,
+      /_ @offset(64) _/
+      screen_vp : mat4x4f,
+    }
+
+    var<private> bytes0 : vec4f;
+
+    var<private> corner0 : vec2f;
+
+    var<private> size_scale0 : vec4f;
 
-    var<private> color : vec4f;
+    var<private> rot_depth0 : vec2f;
 
-    var<private> color0 : vec4f;
+    var<private> pos0 : vec2f;
+
+    @group(0) @binding(0) var<uniform> x_75 : vs_params;
+
+    var<private> gl_Position : vec4f;
 
     var<private> uv : vec2f;
 
-    var<private> uv0 : vec2f;
+    var<private> uv_rect0 : vec4f;
 
     var<private> color_override : vec4f;
 
@@ -697,21 +1783,60 @@ static const uint8_t fs_source_metal_macos[1051] = {
 
     var<private> bytes : vec4f;
 
-    var<private> bytes0 : vec4f;
-
-    var<private> gl_Position : vec4f;
-
     fn main_1() {
-      let x_18 : vec4f = position0;
-      gl_Position = x_18;
-      let x_23 : vec4f = color0;
-      color = x_23;
-      let x_29 : vec2f = uv0;
-      uv = x_29;
-      let x_32 : vec4f = color_override0;
-      color_override = x_32;
-      let x_35 : vec4f = bytes0;
-      bytes = x_35;
+      var pivot_index : f32;
+      var pivot_x : f32;
+      var pivot : vec2f;
+      var quad_pos : vec2f;
+      var rotation : f32;
+      var sin_r : f32;
+      var cos_r : f32;
+      var world_pos : vec2f;
+      var vp : mat4x4f;
+      let x_13 : f32 = bytes0.z;
+      pivot_index = floor(((x_13 * 255.0f) + 0.5f));
+      let x_20 : f32 = pivot_index;
+      pivot_x = floor(((x_20 + 0.5f) / 3.0f));
+      let x_26 : f32 = pivot_x;
+      let x_27 : f32 = pivot_index;
+      let x_28 : f32 = pivot_x;
+      pivot = (vec2f(x_26, (x_27 - (x_28 * 3.0f))) * 0.5f);
+      let x_27 : vec2f = corner0;
+      let x_28 : vec2f = pivot;
+      let x_31 : vec4f = size_scale0;
+      quad_pos = ((x_27 - x_28) * vec2f(x_31.x, x_31.y));
+      let x_38 : f32 = rot_depth0.x;
+      rotation = (x_38 * 3.14159274101257324219f);
+      let x_42 : f32 = rotation;
+      sin_r = sin(x_42);
+      let x_45 : f32 = rotation;
+      cos_r = cos(x_45);
+      let x_50 : vec2f = pos0;
+      let x_52 : vec2f = quad_pos;
+      let x_55 : vec2f = quad_pos;
+      let x_59 : vec2f = quad_pos;
+      let x_62 : vec2f = quad_pos;
+      let x_67 : vec4f = size_scale0;
+      world_pos = (x_50 + (vec2f(((cos_r * x_52.x) - (sin_r * x_55.y)), ((sin_r * x_59.x) + (cos_r * x_62.y))) * vec2f(x_67.z, x_67.w)));
+      let x_80 : mat4x4f = x_75.world_vp;
+      vp = x_80;
+      let x_83 : f32 = bytes0.y;
+      if ((x_83 > 0.5f)) {
+        let x_88 : mat4x4f = x_75.screen_vp;
+        vp = x_88;
+      }
+      let x_93 : mat4x4f = vp;
+      let x_94 : vec2f = world_pos;
+      let x_96 : f32 = rot_depth0.y;
+      gl_Position = (x_93 * vec4f(x_94.x, x_94.y, x_96, 1.0f));
+      let x_104 : vec4f = uv_rect0;
+      let x_106 : vec4f = uv_rect0;
+      let x_108 : vec2f = corner0;
+      uv = mix(vec2f(x_104.x, x_104.y), vec2f(x_106.z, x_106.w), x_108);
+      let x_112 : vec4f = color_override0;
+      color_override = x_112;
+      let x_115 : vec4f = bytes0;
+      bytes = x_115;
       return;
     }
 
@@ -719,159 +1844,354 @@ static const uint8_t fs_source_metal_macos[1051] = {
       @builtin(position)
       gl_Position : vec4f,
       @location(0)
-      color_1 : vec4f,
-      @location(1)
       uv_1 : vec2f,
-      @location(2)
+      @location(1)
       color_override_1 : vec4f,
-      @location(3)
+      @location(2)
       bytes_1 : vec4f,
     }
 
     @vertex
-    fn main(@location(0) position0_param : vec4f, @location(1) color0_param : vec4f, @location(2) uv0_param : vec2f, @location(3) color_override0_param : vec4f, @location(4) bytes0_param : vec4f) -> main_out {
-      position0 = position0_param;
-      color0 = color0_param;
-      uv0 = uv0_param;
-      color_override0 = color_override0_param;
+    fn main(@location(6) bytes0_param : vec4f, @location(0) corner0_param : vec2f, @location(2) size_scale0_param : vec4f, @location(3) rot_depth0_param : vec2f, @location(1) pos0_param : vec2f, @location(4) uv_rect0_param : vec4f, @location(5) color_override0_param : vec4f) -> main_out {
       bytes0 = bytes0_param;
+      corner0 = corner0_param;
+      size_scale0 = size_scale0_param;
+      rot_depth0 = rot_depth0_param;
+      pos0 = pos0_param;
+      uv_rect0 = uv_rect0_param;
+      color_override0 = color_override0_param;
       main_1();
-      return main_out(gl_Position, color, uv, color_override, bytes);
+      return main_out(gl_Position, uv, color_override, bytes);
     }
 
 */
-static const uint8_t vs_source_wgsl[1276] = {
+static const uint8_t vs_source_wgsl[3069] = {
     0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
     0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
-    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
-    0x76,0x61,0x74,0x65,0x3e,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x30,0x20,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x2f,0x2a,
+    0x20,0x40,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x30,0x29,0x20,0x2a,0x2f,0x0a,0x20,
+    0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x76,0x70,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,
+    0x78,0x34,0x66,0x2c,0x0a,0x20,0x20,0x2f,0x2a,0x20,0x40,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x36,0x34,0x29,0x20,0x2a,0x2f,0x0a,0x20,0x20,0x73,0x63,0x72,0x65,0x65,
+    0x6e,0x5f,0x76,0x70,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x2c,0x0a,
+    0x7d,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x62,0x79,0x74,0x65,0x73,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,
+    0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,
+    0x72,0x6e,0x65,0x72,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,
+    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x73,0x69,0x7a,
+    0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
+    0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
+    0x3e,0x20,0x70,0x6f,0x73,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,
+    0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x3e,0x20,0x78,0x5f,0x37,0x35,0x20,0x3a,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
+    0x74,0x65,0x3e,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
     0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
-    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,
-    0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
-    0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
-    0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,
-    0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x30,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
-    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,
-    0x72,0x72,0x69,0x64,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,
-    0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,
-    0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x20,0x3a,0x20,0x76,
-    0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
-    0x74,0x65,0x3e,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,
+    0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
+    0x20,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
     0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,
-    0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,
-    0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x67,
-    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,
-    0x20,0x7b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x38,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x30,0x3b,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x20,0x3d,0x20,0x78,0x5f,0x31,0x38,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
-    0x5f,0x32,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x63,0x6f,
-    0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
-    0x78,0x5f,0x32,0x33,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x39,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x75,0x76,0x30,0x3b,0x0a,
-    0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x78,0x5f,0x32,0x39,0x3b,0x0a,0x20,0x20,0x6c,
-    0x65,0x74,0x20,0x78,0x5f,0x33,0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,
-    0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,
-    0x30,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,
-    0x69,0x64,0x65,0x20,0x3d,0x20,0x78,0x5f,0x33,0x32,0x3b,0x0a,0x20,0x20,0x6c,0x65,
-    0x74,0x20,0x78,0x5f,0x33,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,
-    0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x20,0x20,0x62,0x79,0x74,0x65,0x73,
-    0x20,0x3d,0x20,0x78,0x5f,0x33,0x35,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
-    0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
-    0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,0x75,0x69,0x6c,0x74,
-    0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x20,0x20,0x67,
-    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
-    0x30,0x29,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x31,0x20,0x3a,0x20,0x76,
-    0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x75,0x76,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
-    0x28,0x32,0x29,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,
-    0x72,0x69,0x64,0x65,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,
-    0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,0x0a,0x20,
-    0x20,0x62,0x79,0x74,0x65,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
-    0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,
-    0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,
-    0x29,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x30,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,
-    0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x75,0x76,0x30,0x5f,0x70,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,
+    0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,
+    0x72,0x72,0x69,0x64,0x65,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,
+    0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x62,0x79,
+    0x74,0x65,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,
+    0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,
+    0x72,0x20,0x70,0x69,0x76,0x6f,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,
+    0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x70,0x69,0x76,0x6f,0x74,
+    0x5f,0x78,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,
+    0x70,0x69,0x76,0x6f,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x20,
+    0x20,0x76,0x61,0x72,0x20,0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x72,0x6f,0x74,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,
+    0x61,0x72,0x20,0x73,0x69,0x6e,0x5f,0x72,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,
+    0x20,0x20,0x76,0x61,0x72,0x20,0x63,0x6f,0x73,0x5f,0x72,0x20,0x3a,0x20,0x66,0x33,
+    0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,
+    0x6f,0x73,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,
+    0x72,0x20,0x76,0x70,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x3b,0x0a,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x33,0x20,0x3a,0x20,0x66,0x33,0x32,
+    0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x70,
+    0x69,0x76,0x6f,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x6f,0x72,0x28,0x28,0x28,0x78,0x5f,0x31,0x33,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,
+    0x30,0x66,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x30,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,
+    0x20,0x70,0x69,0x76,0x6f,0x74,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x20,0x20,
+    0x70,0x69,0x76,0x6f,0x74,0x5f,0x78,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,
+    0x28,0x28,0x78,0x5f,0x32,0x30,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x20,0x2f,
+    0x20,0x33,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
+    0x5f,0x32,0x36,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x70,0x69,0x76,0x6f,
+    0x74,0x5f,0x78,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x37,0x20,
+    0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x70,0x69,0x76,0x6f,0x74,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x38,0x20,
+    0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x70,0x69,0x76,0x6f,0x74,0x5f,0x78,0x3b,
+    0x0a,0x20,0x20,0x70,0x69,0x76,0x6f,0x74,0x20,0x3d,0x20,0x28,0x76,0x65,0x63,0x32,
+    0x66,0x28,0x78,0x5f,0x32,0x36,0x2c,0x20,0x28,0x78,0x5f,0x32,0x37,0x20,0x2d,0x20,
+    0x28,0x78,0x5f,0x32,0x38,0x20,0x2a,0x20,0x33,0x2e,0x30,0x66,0x29,0x29,0x29,0x20,
+    0x2a,0x20,0x30,0x2e,0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
+    0x5f,0x32,0x37,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x63,0x6f,
+    0x72,0x6e,0x65,0x72,0x30,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,
+    0x38,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x70,0x69,0x76,0x6f,
+    0x74,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x33,0x31,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,
+    0x6c,0x65,0x30,0x3b,0x0a,0x20,0x20,0x71,0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x28,0x28,0x78,0x5f,0x32,0x37,0x20,0x2d,0x20,0x78,0x5f,0x32,0x38,0x29,
+    0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x66,0x28,0x78,0x5f,0x33,0x31,0x2e,0x78,0x2c,
+    0x20,0x78,0x5f,0x33,0x31,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,
+    0x20,0x78,0x5f,0x33,0x38,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x72,0x6f,
+    0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x72,0x6f,
+    0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x78,0x5f,0x33,0x38,0x20,0x2a,
+    0x20,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,
+    0x37,0x33,0x32,0x34,0x32,0x31,0x39,0x66,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,
+    0x20,0x78,0x5f,0x34,0x32,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x72,0x6f,
+    0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x73,0x69,0x6e,0x5f,0x72,0x20,
+    0x3d,0x20,0x73,0x69,0x6e,0x28,0x78,0x5f,0x34,0x32,0x29,0x3b,0x0a,0x20,0x20,0x6c,
+    0x65,0x74,0x20,0x78,0x5f,0x34,0x35,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,
+    0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x73,0x5f,
+    0x72,0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x78,0x5f,0x34,0x35,0x29,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,
+    0x66,0x20,0x3d,0x20,0x70,0x6f,0x73,0x30,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x35,0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x71,
+    0x75,0x61,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
+    0x5f,0x35,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x71,0x75,
+    0x61,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,
+    0x35,0x39,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x71,0x75,0x61,
+    0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,
+    0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x71,0x75,0x61,0x64,
+    0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,0x37,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x5f,
+    0x73,0x63,0x61,0x6c,0x65,0x30,0x3b,0x0a,0x20,0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,
+    0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x78,0x5f,0x35,0x30,0x20,0x2b,0x20,0x28,0x76,
+    0x65,0x63,0x32,0x66,0x28,0x28,0x28,0x63,0x6f,0x73,0x5f,0x72,0x20,0x2a,0x20,0x78,
+    0x5f,0x35,0x32,0x2e,0x78,0x29,0x20,0x2d,0x20,0x28,0x73,0x69,0x6e,0x5f,0x72,0x20,
+    0x2a,0x20,0x78,0x5f,0x35,0x35,0x2e,0x79,0x29,0x29,0x2c,0x20,0x28,0x28,0x73,0x69,
+    0x6e,0x5f,0x72,0x20,0x2a,0x20,0x78,0x5f,0x35,0x39,0x2e,0x78,0x29,0x20,0x2b,0x20,
+    0x28,0x63,0x6f,0x73,0x5f,0x72,0x20,0x2a,0x20,0x78,0x5f,0x36,0x32,0x2e,0x79,0x29,
+    0x29,0x29,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x66,0x28,0x78,0x5f,0x36,0x37,0x2e,
+    0x7a,0x2c,0x20,0x78,0x5f,0x36,0x37,0x2e,0x77,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x30,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,
+    0x34,0x66,0x20,0x3d,0x20,0x78,0x5f,0x37,0x35,0x2e,0x77,0x6f,0x72,0x6c,0x64,0x5f,
+    0x76,0x70,0x3b,0x0a,0x20,0x20,0x76,0x70,0x20,0x3d,0x20,0x78,0x5f,0x38,0x30,0x3b,
+    0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x33,0x20,0x3a,0x20,0x66,0x33,
+    0x32,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x2e,0x79,0x3b,0x0a,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x28,0x78,0x5f,0x38,0x33,0x20,0x3e,0x20,0x30,0x2e,0x35,0x66,
+    0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,
+    0x38,0x20,0x3a,0x20,0x6d,0x61,0x74,0x34,0x78,0x34,0x66,0x20,0x3d,0x20,0x78,0x5f,
+    0x37,0x35,0x2e,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x76,0x70,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x70,0x20,0x3d,0x20,0x78,0x5f,0x38,0x38,0x3b,0x0a,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x39,0x33,0x20,0x3a,0x20,0x6d,0x61,
+    0x74,0x34,0x78,0x34,0x66,0x20,0x3d,0x20,0x76,0x70,0x3b,0x0a,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x39,0x34,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,
+    0x20,0x77,0x6f,0x72,0x6c,0x64,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x39,0x36,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x72,
+    0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x78,0x5f,
+    0x39,0x33,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x78,0x5f,0x39,0x34,0x2e,
+    0x78,0x2c,0x20,0x78,0x5f,0x39,0x34,0x2e,0x79,0x2c,0x20,0x78,0x5f,0x39,0x36,0x2c,
+    0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
+    0x5f,0x31,0x30,0x34,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
+    0x5f,0x31,0x30,0x36,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
+    0x5f,0x31,0x30,0x38,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x30,0x3b,0x0a,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x6d,
+    0x69,0x78,0x28,0x76,0x65,0x63,0x32,0x66,0x28,0x78,0x5f,0x31,0x30,0x34,0x2e,0x78,
+    0x2c,0x20,0x78,0x5f,0x31,0x30,0x34,0x2e,0x79,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,
+    0x66,0x28,0x78,0x5f,0x31,0x30,0x36,0x2e,0x7a,0x2c,0x20,0x78,0x5f,0x31,0x30,0x36,
+    0x2e,0x77,0x29,0x2c,0x20,0x78,0x5f,0x31,0x30,0x38,0x29,0x3b,0x0a,0x20,0x20,0x6c,
+    0x65,0x74,0x20,0x78,0x5f,0x31,0x31,0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,
+    0x65,0x30,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,
+    0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x78,0x5f,0x31,0x31,0x32,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x31,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x20,0x20,0x62,0x79,
+    0x74,0x65,0x73,0x20,0x3d,0x20,0x78,0x5f,0x31,0x31,0x35,0x3b,0x0a,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x40,0x62,
+    0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,
+    0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x75,0x76,0x5f,0x31,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,
+    0x65,0x72,0x72,0x69,0x64,0x65,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,
+    0x0a,0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,0x65,0x72,0x74,0x65,0x78,0x0a,0x66,
+    0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x28,0x36,0x29,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x30,0x5f,0x70,
     0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x73,0x69,0x7a,0x65,0x5f,
+    0x73,0x63,0x61,0x6c,0x65,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,
+    0x33,0x29,0x20,0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x70,0x6f,0x73,0x30,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x34,0x29,0x20,0x75,0x76,0x5f,0x72,0x65,
+    0x63,0x74,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x35,0x29,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x29,0x20,0x2d,
+    0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x30,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x30,0x20,
+    0x3d,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,
+    0x0a,0x20,0x20,0x73,0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x30,0x20,0x3d,
+    0x20,0x73,0x69,0x7a,0x65,0x5f,0x73,0x63,0x61,0x6c,0x65,0x30,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x3b,0x0a,0x20,0x20,0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,
+    0x20,0x3d,0x20,0x72,0x6f,0x74,0x5f,0x64,0x65,0x70,0x74,0x68,0x30,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x70,0x6f,0x73,0x30,0x20,0x3d,0x20,0x70,0x6f,
+    0x73,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,0x5f,0x72,
+    0x65,0x63,0x74,0x30,0x20,0x3d,0x20,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x30,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
+    0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,
     0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,
-    0x69,0x6f,0x6e,0x28,0x34,0x29,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x29,0x20,0x2d,0x3e,0x20,
-    0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x30,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,
-    0x72,0x30,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x75,0x76,0x30,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,
-    0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
-    0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,
-    0x0a,0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,
-    0x73,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,
-    0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,
-    0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x2c,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x75,0x76,0x2c,0x20,
-    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x2c,0x20,
-    0x62,0x79,0x74,0x65,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x75,0x76,0x2c,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x2c,
+    0x20,0x62,0x79,0x74,0x65,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     diagnostic(off, derivative_uniformity);
 
     var<private> bytes : vec4f;
 
-    @group(1) @binding(64) var texture0 : texture_2d<f32>;
+    @group(1) @binding(64) var image0 : texture_2d<f32>;
 
     @group(1) @binding(80) var default_sampler : sampler;
 
     var<private> uv : vec2f;
 
-    @group(1) @binding(65) var fontTex1 : texture_2d<f32>;
+    @group(1) @binding(65) var image1 : texture_2d<f32>;
 
-    var<private> col_out : vec4f;
+    @group(1) @binding(66) var image2 : texture_2d<f32>;
+
+    @group(1) @binding(67) var image3 : texture_2d<f32>;
+
+    @group(1) @binding(68) var image4 : texture_2d<f32>;
+
+    @group(1) @binding(69) var image5 : texture_2d<f32>;
+
+    @group(1) @binding(70) var image6 : texture_2d<f32>;
+
+    @group(1) @binding(71) var image7 : texture_2d<f32>;
 
-    var<private> color : vec4f;
+    @group(1) @binding(72) var fontPages8 : texture_2d_array<f32>;
+
+    @group(1) @binding(73) var atlasPages9 : texture_2d_array<f32>;
+
+    @group(1) @binding(81) var glyph_sampler : sampler;
+
+    var<private> col_out : vec4f;
 
     var<private> color_override : vec4f;
 
     fn main_1() {
+      var tex_byte : i32;
       var tex_index : i32;
+      var layer : f32;
       var tex_col : vec4f;
+      var x_88 : bool;
       let x_17 : f32 = bytes.x;
-      tex_index = i32((x_17 * 255.0f));
+      tex_byte = i32(((x_17 * 255.0f) + 0.5f));
+      let x_24 : i32 = tex_byte;
+      tex_index = (x_24 & 127i);
+      let x_30 : f32 = bytes.w;
+      layer = floor(((x_30 * 255.0f) + 0.5f));
       tex_col = vec4f(1.0f, 1.0f, 1.0f, 1.0f);
-      let x_25 : i32 = tex_index;
-      if ((x_25 == 0i)) {
-        let x_44 : vec2f = uv;
-        let x_45 : vec4f = textureSample(texture0, default_sampler, x_44);
-        tex_col = x_45;
+      let x_36 : i32 = tex_index;
+      if ((x_36 == 0i)) {
+        let x_46 : f32 = layer;
+        let x_48 : i32 = i32(x_46);
+        if ((x_48 == 0i)) {
+          let x_50 : vec4f = textureSample(image0, default_sampler, uv);
+          tex_col = x_50;
+        } else {
+          if ((x_48 == 1i)) {
+            let x_51 : vec4f = textureSample(image1, default_sampler, uv);
+            tex_col = x_51;
+          } else {
+            if ((x_48 == 2i)) {
+              let x_52 : vec4f = textureSample(image2, default_sampler, uv);
+              tex_col = x_52;
+            } else {
+              if ((x_48 == 3i)) {
+                let x_53 : vec4f = textureSample(image3, default_sampler, uv);
+                tex_col = x_53;
+              } else {
+                if ((x_48 == 4i)) {
+                  let x_54 : vec4f = textureSample(image4, default_sampler, uv);
+                  tex_col = x_54;
+                } else {
+                  if ((x_48 == 5i)) {
+                    let x_55 : vec4f = textureSample(image5, default_sampler, uv);
+                    tex_col = x_55;
+                  } else {
+                    if ((x_48 == 6i)) {
+                      let x_56 : vec4f = textureSample(image6, default_sampler, uv);
+                      tex_col = x_56;
+                    } else {
+                      if ((x_48 == 7i)) {
+                        let x_57 : vec4f = textureSample(image7, default_sampler, uv);
+                        tex_col = x_57;
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
       } else {
-        let x_47 : i32 = tex_index;
-        if ((x_47 == 1i)) {
-          let x_56 : vec2f = uv;
-          let x_57 : vec4f = textureSample(fontTex1, default_sampler, x_56);
-          tex_col = x_57;
+        let x_62 : i32 = tex_index;
+        if ((x_62 == 1i)) {
+          let x_66 : f32 = layer;
+          let x_67 : vec4f = textureSample(fontPages8, default_sampler, uv, i32(round(x_66)));
+          tex_col = x_67;
+        } else {
+          let x_70 : i32 = tex_index;
+          if ((x_70 == 2i)) {
+            let x_74 : f32 = layer;
+            let x_75 : vec4f = textureSample(atlasPages9, default_sampler, uv, i32(round(x_74)));
+            tex_col = x_75;
+          } else {
+            let x_77 : i32 = tex_index;
+            if ((x_77 == 3i)) {
+              let x_79 : f32 = layer;
+              let x_80 : f32 = textureSample(fontPages8, glyph_sampler, uv, i32(round(x_79))).w;
+              let x_84 : f32 = fwidth(x_80);
+              tex_col = vec4f(1.0f, 1.0f, 1.0f, smoothstep((0.5f - x_84), (0.5f + x_84), x_80));
+            }
+          }
         }
       }
-      let x_60 : vec4f = tex_col;
-      col_out = x_60;
-      let x_62 : vec4f = color;
-      let x_63 : vec4f = col_out;
-      col_out = (x_63 * x_62);
-      let x_66 : vec4f = col_out;
-      let x_69 : vec4f = color_override;
-      let x_73 : f32 = color_override.w;
-      let x_75 : vec3f = mix(vec3f(x_66.x, x_66.y, x_66.z), vec3f(x_69.x, x_69.y, x_69.z), vec3f(x_73, x_73, x_73));
-      col_out.x = x_75.x;
-      col_out.y = x_75.y;
-      col_out.z = x_75.z;
+      let x_81 : i32 = tex_byte;
+      let x_83 : bool = (x_81 >= 128i);
+      x_88 = x_83;
+      if (x_83) {
+        let x_86 : f32 = tex_col.w;
+        x_88 = (x_86 < 0.5f);
+      }
+      if (x_88) {
+        discard;
+      }
+      let x_82 : vec4f = tex_col;
+      col_out = x_82;
+      let x_84 : vec4f = col_out;
+      let x_87 : vec4f = color_override;
+      let x_91 : f32 = color_override.w;
+      let x_93 : vec3f = mix(vec3f(x_84.x, x_84.y, x_84.z), vec3f(x_87.x, x_87.y, x_87.z), vec3f(x_91, x_91, x_91));
+      col_out.x = x_93.x;
+      col_out.y = x_93.y;
+      col_out.z = x_93.z;
       return;
     }
 
@@ -881,124 +2201,285 @@ static const uint8_t vs_source_wgsl[1276] = {
     }
 
     @fragment
-    fn main(@location(3) bytes_param : vec4f, @location(1) uv_param : vec2f, @location(0) color_param : vec4f, @location(2) color_override_param : vec4f) -> main_out {
+    fn main(@location(2) bytes_param : vec4f, @location(0) uv_param : vec2f, @location(1) color_override_param : vec4f) -> main_out {
       bytes = bytes_param;
       uv = uv_param;
-      color = color_param;
       color_override = color_override_param;
       main_1();
       return main_out(col_out);
     }
 
 */
-static const uint8_t fs_source_wgsl[1707] = {
+static const uint8_t fs_source_wgsl[4289] = {
     0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
     0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
     0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,
     0x76,0x61,0x74,0x65,0x3e,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x3a,0x20,0x76,0x65,
     0x63,0x34,0x66,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,
     0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x34,0x29,0x20,0x76,0x61,0x72,
-    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,
-    0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,
-    0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
-    0x28,0x38,0x30,0x29,0x20,0x76,0x61,0x72,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
-    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x73,0x61,0x6d,0x70,0x6c,
-    0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,
-    0x3e,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x40,
-    0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,
-    0x67,0x28,0x36,0x35,0x29,0x20,0x76,0x61,0x72,0x20,0x66,0x6f,0x6e,0x74,0x54,0x65,
-    0x78,0x31,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,
-    0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,
-    0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,
-    0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x20,0x69,0x6d,0x61,0x67,0x65,0x30,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,
+    0x75,0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x38,
+    0x30,0x29,0x20,0x76,0x61,0x72,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
     0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,
-    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3a,
-    0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,
-    0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x65,0x78,
-    0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x69,0x33,0x32,0x3b,0x0a,0x20,0x20,
-    0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x31,0x37,0x20,
-    0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x2e,0x78,0x3b,
-    0x0a,0x20,0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x69,
-    0x33,0x32,0x28,0x28,0x78,0x5f,0x31,0x37,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,
-    0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,
-    0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,
-    0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,
-    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x35,0x20,0x3a,0x20,0x69,0x33,0x32,
-    0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x28,0x78,0x5f,0x32,0x35,0x20,0x3d,0x3d,0x20,0x30,0x69,0x29,
-    0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x34,0x34,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x34,0x35,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x34,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,
-    0x70,0x6c,0x65,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x2c,0x20,0x64,0x65,
-    0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x78,
-    0x5f,0x34,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,
-    0x6c,0x20,0x3d,0x20,0x78,0x5f,0x34,0x35,0x3b,0x0a,0x20,0x20,0x7d,0x20,0x65,0x6c,
-    0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x34,
-    0x37,0x20,0x3a,0x20,0x69,0x33,0x32,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,
-    0x64,0x65,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x78,0x5f,
-    0x34,0x37,0x20,0x3d,0x3d,0x20,0x31,0x69,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,0x36,0x20,0x3a,0x20,0x76,0x65,
-    0x63,0x32,0x66,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x3b,0x0a,0x0a,0x40,0x67,0x72,
+    0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,
+    0x36,0x35,0x29,0x20,0x76,0x61,0x72,0x20,0x69,0x6d,0x61,0x67,0x65,0x31,0x20,0x3a,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,
+    0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,
+    0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x36,0x29,0x20,0x76,0x61,0x72,0x20,0x69,0x6d,
+    0x61,0x67,0x65,0x32,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,
+    0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,
+    0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x37,0x29,0x20,
+    0x76,0x61,0x72,0x20,0x69,0x6d,0x61,0x67,0x65,0x33,0x20,0x3a,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,
+    0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,
+    0x67,0x28,0x36,0x38,0x29,0x20,0x76,0x61,0x72,0x20,0x69,0x6d,0x61,0x67,0x65,0x34,
+    0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,
+    0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x36,0x39,0x29,0x20,0x76,0x61,0x72,0x20,
+    0x69,0x6d,0x61,0x67,0x65,0x35,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,
+    0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x37,0x30,
+    0x29,0x20,0x76,0x61,0x72,0x20,0x69,0x6d,0x61,0x67,0x65,0x36,0x20,0x3a,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,
+    0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x28,0x37,0x31,0x29,0x20,0x76,0x61,0x72,0x20,0x69,0x6d,0x61,0x67,
+    0x65,0x37,0x20,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x3c,
+    0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,
+    0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x37,0x32,0x29,0x20,0x76,0x61,
+    0x72,0x20,0x66,0x6f,0x6e,0x74,0x50,0x61,0x67,0x65,0x73,0x38,0x20,0x3a,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,
+    0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,
+    0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x37,0x33,0x29,0x20,0x76,0x61,
+    0x72,0x20,0x61,0x74,0x6c,0x61,0x73,0x50,0x61,0x67,0x65,0x73,0x39,0x20,0x3a,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,
+    0x3c,0x66,0x33,0x32,0x3e,0x3b,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,
+    0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x38,0x31,0x29,0x20,0x76,
+    0x61,0x72,0x20,0x67,0x6c,0x79,0x70,0x68,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x20,0x3a,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x61,0x72,
+    0x3c,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,
+    0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x0a,0x76,0x61,0x72,0x3c,
+    0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x3e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
+    0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x3b,
+    0x0a,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x20,0x7b,0x0a,
+    0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x5f,0x62,0x79,0x74,0x65,0x20,0x3a,
+    0x20,0x69,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x5f,
+    0x69,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x69,0x33,0x32,0x3b,0x0a,0x20,0x20,0x76,
+    0x61,0x72,0x20,0x6c,0x61,0x79,0x65,0x72,0x20,0x3a,0x20,0x66,0x33,0x32,0x3b,0x0a,
+    0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x34,0x66,0x3b,0x0a,0x20,0x20,0x76,0x61,0x72,0x20,0x78,0x5f,0x38,
+    0x38,0x20,0x3a,0x20,0x62,0x6f,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x31,0x37,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x62,0x79,0x74,
+    0x65,0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x5f,0x62,0x79,0x74,0x65,
+    0x20,0x3d,0x20,0x69,0x33,0x32,0x28,0x28,0x28,0x78,0x5f,0x31,0x37,0x20,0x2a,0x20,
+    0x32,0x35,0x35,0x2e,0x30,0x66,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x32,0x34,0x20,0x3a,0x20,0x69,
+    0x33,0x32,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x62,0x79,0x74,0x65,0x3b,0x0a,0x20,
+    0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x28,0x78,0x5f,
+    0x32,0x34,0x20,0x26,0x20,0x31,0x32,0x37,0x69,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x33,0x30,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x62,
+    0x79,0x74,0x65,0x73,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x6c,0x61,0x79,0x65,0x72,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x28,0x28,0x78,0x5f,0x33,0x30,0x20,0x2a,
+    0x20,0x32,0x35,0x35,0x2e,0x30,0x66,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x28,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2c,
+    0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x33,0x36,0x20,0x3a,0x20,0x69,0x33,0x32,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x28,0x78,0x5f,0x33,0x36,0x20,0x3d,0x3d,0x20,0x30,0x69,0x29,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x34,0x36,0x20,0x3a,
+    0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x34,0x38,0x20,0x3a,0x20,0x69,0x33,0x32,
+    0x20,0x3d,0x20,0x69,0x33,0x32,0x28,0x78,0x5f,0x34,0x36,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x78,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x30,
+    0x69,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x35,0x30,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x6d,0x61,
+    0x67,0x65,0x30,0x2c,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x78,0x5f,0x35,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x78,0x5f,0x34,0x38,0x20,0x3d,0x3d,
+    0x20,0x31,0x69,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x69,0x6d,0x61,0x67,0x65,0x31,0x2c,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,
+    0x20,0x78,0x5f,0x35,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,
+    0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x28,0x78,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x32,0x69,0x29,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x35,0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x6d,0x61,
+    0x67,0x65,0x32,0x2c,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x78,
+    0x5f,0x35,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,
+    0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x28,0x78,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x33,0x69,0x29,
+    0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x69,0x6d,0x61,0x67,0x65,0x33,0x2c,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,
+    0x6f,0x6c,0x20,0x3d,0x20,0x78,0x5f,0x35,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x78,
+    0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x34,0x69,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x35,0x34,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x6d,0x61,
+    0x67,0x65,0x34,0x2c,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,
+    0x20,0x3d,0x20,0x78,0x5f,0x35,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x28,0x78,0x5f,0x34,0x38,0x20,0x3d,0x3d,0x20,0x35,0x69,0x29,0x29,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x69,0x6d,0x61,0x67,0x65,0x35,0x2c,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x78,0x5f,0x35,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,
+    0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x78,0x5f,0x34,0x38,0x20,
+    0x3d,0x3d,0x20,0x36,0x69,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x35,0x36,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x69,0x6d,0x61,
+    0x67,0x65,0x36,0x2c,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,
+    0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x78,0x5f,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,
+    0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x78,0x5f,0x34,
+    0x38,0x20,0x3d,0x3d,0x20,0x37,0x69,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
     0x6c,0x65,0x74,0x20,0x78,0x5f,0x35,0x37,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,
     0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,
-    0x28,0x66,0x6f,0x6e,0x74,0x54,0x65,0x78,0x31,0x2c,0x20,0x64,0x65,0x66,0x61,0x75,
-    0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x78,0x5f,0x35,0x36,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,
-    0x20,0x3d,0x20,0x78,0x5f,0x35,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,0x30,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x3b,
-    0x0a,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x3d,0x20,0x78,0x5f,0x36,
-    0x30,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,0x32,0x20,0x3a,0x20,
-    0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,
-    0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
-    0x66,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x3b,0x0a,0x20,0x20,0x63,
-    0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x3d,0x20,0x28,0x78,0x5f,0x36,0x33,0x20,0x2a,
-    0x20,0x78,0x5f,0x36,0x32,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,
-    0x36,0x36,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x63,0x6f,0x6c,
-    0x5f,0x6f,0x75,0x74,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,0x39,
-    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,
-    0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,
-    0x20,0x78,0x5f,0x37,0x33,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x63,0x6f,
-    0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x2e,0x77,0x3b,0x0a,
-    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x37,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,
-    0x33,0x66,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x76,0x65,0x63,0x33,0x66,0x28,0x78,
-    0x5f,0x36,0x36,0x2e,0x78,0x2c,0x20,0x78,0x5f,0x36,0x36,0x2e,0x79,0x2c,0x20,0x78,
-    0x5f,0x36,0x36,0x2e,0x7a,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,
-    0x36,0x39,0x2e,0x78,0x2c,0x20,0x78,0x5f,0x36,0x39,0x2e,0x79,0x2c,0x20,0x78,0x5f,
-    0x36,0x39,0x2e,0x7a,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x37,
-    0x33,0x2c,0x20,0x78,0x5f,0x37,0x33,0x2c,0x20,0x78,0x5f,0x37,0x33,0x29,0x29,0x3b,
-    0x0a,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x78,0x20,0x3d,0x20,0x78,
-    0x5f,0x37,0x35,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,
-    0x2e,0x79,0x20,0x3d,0x20,0x78,0x5f,0x37,0x35,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x63,
-    0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x7a,0x20,0x3d,0x20,0x78,0x5f,0x37,0x35,0x2e,
-    0x7a,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,
-    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,
-    0x7b,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,
-    0x0a,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x5f,0x31,0x20,0x3a,0x20,0x76,
-    0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,
-    0x6e,0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,
-    0x74,0x69,0x6f,0x6e,0x28,0x33,0x29,0x20,0x62,0x79,0x74,0x65,0x73,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,
-    0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,
-    0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x63,0x6f,0x6c,0x6f,0x72,
-    0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,
-    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,
-    0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x3d,
-    0x20,0x62,0x79,0x74,0x65,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,
-    0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,
-    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,
-    0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
-    0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,
-    0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,
-    0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x63,0x6f,0x6c,
-    0x5f,0x6f,0x75,0x74,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x28,0x69,0x6d,0x61,0x67,0x65,0x37,0x2c,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x78,0x5f,0x35,
+    0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x7d,0x20,0x65,
+    0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,
+    0x36,0x32,0x20,0x3a,0x20,0x69,0x33,0x32,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x69,
+    0x6e,0x64,0x65,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x78,
+    0x5f,0x36,0x32,0x20,0x3d,0x3d,0x20,0x31,0x69,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,0x36,0x20,0x3a,0x20,0x66,
+    0x33,0x32,0x20,0x3d,0x20,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x36,0x37,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x34,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x66,0x6f,0x6e,0x74,0x50,0x61,0x67,0x65,0x73,0x38,0x2c,0x20,0x64,
+    0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,
+    0x75,0x76,0x2c,0x20,0x69,0x33,0x32,0x28,0x72,0x6f,0x75,0x6e,0x64,0x28,0x78,0x5f,
+    0x36,0x36,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,
+    0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x78,0x5f,0x36,0x37,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6c,0x65,0x74,0x20,0x78,0x5f,0x37,0x30,0x20,0x3a,0x20,0x69,0x33,0x32,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x78,0x5f,0x37,0x30,0x20,0x3d,0x3d,0x20,0x32,
+    0x69,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x37,0x34,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x6c,
+    0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x37,0x35,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x61,
+    0x74,0x6c,0x61,0x73,0x50,0x61,0x67,0x65,0x73,0x39,0x2c,0x20,0x64,0x65,0x66,0x61,
+    0x75,0x6c,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x2c,
+    0x20,0x69,0x33,0x32,0x28,0x72,0x6f,0x75,0x6e,0x64,0x28,0x78,0x5f,0x37,0x34,0x29,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,
+    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x78,0x5f,0x37,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x37,0x37,0x20,0x3a,0x20,0x69,0x33,
+    0x32,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x78,0x5f,0x37,0x37,
+    0x20,0x3d,0x3d,0x20,0x33,0x69,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x37,0x39,0x20,0x3a,0x20,
+    0x66,0x33,0x32,0x20,0x3d,0x20,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x30,0x20,
+    0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x28,0x66,0x6f,0x6e,0x74,0x50,0x61,0x67,0x65,0x73,0x38,
+    0x2c,0x20,0x67,0x6c,0x79,0x70,0x68,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,
+    0x20,0x75,0x76,0x2c,0x20,0x69,0x33,0x32,0x28,0x72,0x6f,0x75,0x6e,0x64,0x28,0x78,
+    0x5f,0x37,0x39,0x29,0x29,0x29,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x34,0x20,0x3a,0x20,0x66,
+    0x33,0x32,0x20,0x3d,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x78,0x5f,0x38,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,
+    0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x66,0x28,0x31,0x2e,0x30,
+    0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x73,
+    0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x28,0x30,0x2e,0x35,0x66,0x20,
+    0x2d,0x20,0x78,0x5f,0x38,0x34,0x29,0x2c,0x20,0x28,0x30,0x2e,0x35,0x66,0x20,0x2b,
+    0x20,0x78,0x5f,0x38,0x34,0x29,0x2c,0x20,0x78,0x5f,0x38,0x30,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x7d,0x0a,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x38,0x31,0x20,0x3a,0x20,0x69,0x33,0x32,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x5f,0x62,0x79,0x74,0x65,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,
+    0x5f,0x38,0x33,0x20,0x3a,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x3d,0x20,0x28,0x78,0x5f,
+    0x38,0x31,0x20,0x3e,0x3d,0x20,0x31,0x32,0x38,0x69,0x29,0x3b,0x0a,0x20,0x20,0x78,
+    0x5f,0x38,0x38,0x20,0x3d,0x20,0x78,0x5f,0x38,0x33,0x3b,0x0a,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x78,0x5f,0x38,0x33,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x78,0x5f,0x38,0x36,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x5f,0x63,0x6f,0x6c,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x78,0x5f,
+    0x38,0x38,0x20,0x3d,0x20,0x28,0x78,0x5f,0x38,0x36,0x20,0x3c,0x20,0x30,0x2e,0x35,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x7d,0x0a,0x20,0x20,0x69,0x66,0x20,0x28,0x78,0x5f,
+    0x38,0x38,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,
+    0x64,0x3b,0x0a,0x20,0x20,0x7d,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,
+    0x32,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x20,0x3d,
+    0x20,0x78,0x5f,0x38,0x32,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,
+    0x34,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x5f,
+    0x6f,0x75,0x74,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x38,0x37,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,
+    0x78,0x5f,0x39,0x31,0x20,0x3a,0x20,0x66,0x33,0x32,0x20,0x3d,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x2e,0x77,0x3b,0x0a,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x78,0x5f,0x39,0x33,0x20,0x3a,0x20,0x76,0x65,0x63,0x33,
+    0x66,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,
+    0x38,0x34,0x2e,0x78,0x2c,0x20,0x78,0x5f,0x38,0x34,0x2e,0x79,0x2c,0x20,0x78,0x5f,
+    0x38,0x34,0x2e,0x7a,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x38,
+    0x37,0x2e,0x78,0x2c,0x20,0x78,0x5f,0x38,0x37,0x2e,0x79,0x2c,0x20,0x78,0x5f,0x38,
+    0x37,0x2e,0x7a,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x66,0x28,0x78,0x5f,0x39,0x31,
+    0x2c,0x20,0x78,0x5f,0x39,0x31,0x2c,0x20,0x78,0x5f,0x39,0x31,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x78,0x20,0x3d,0x20,0x78,0x5f,
+    0x39,0x33,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x2e,
+    0x79,0x20,0x3d,0x20,0x78,0x5f,0x39,0x33,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x63,0x6f,
+    0x6c,0x5f,0x6f,0x75,0x74,0x2e,0x7a,0x20,0x3d,0x20,0x78,0x5f,0x39,0x33,0x2e,0x7a,
+    0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,
+    0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,
+    0x20,0x20,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x5f,0x31,0x20,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,
+    0x74,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x62,0x79,0x74,0x65,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,
+    0x65,0x72,0x72,0x69,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,
+    0x65,0x63,0x34,0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,
+    0x74,0x20,0x7b,0x0a,0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x62,0x79,
+    0x74,0x65,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x75,0x76,0x20,
+    0x3d,0x20,0x75,0x76,0x5f,0x70,0x61,0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x20,0x3d,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x76,0x65,0x72,0x72,0x69,0x64,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x3b,0x0a,0x20,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x31,0x28,0x29,0x3b,
+    0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,
+    0x75,0x74,0x28,0x63,0x6f,0x6c,0x5f,0x6f,0x75,0x74,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
 };
 static inline const sg_shader_desc* quad_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
@@ -1010,11 +2491,19 @@ static inline const sg_shader_desc* quad_shader_desc(sg_backend backend) {
             desc.vertex_func.entry = "main";
             desc.fragment_func.source = (const char*)fs_source_glsl410;
             desc.fragment_func.entry = "main";
-            desc.attrs[0].glsl_name = "position0";
-            desc.attrs[1].glsl_name = "color0";
-            desc.attrs[2].glsl_name = "uv0";
-            desc.attrs[3].glsl_name = "color_override0";
-            desc.attrs[4].glsl_name = "bytes0";
+            desc.attrs[0].glsl_name = "corner0";
+            desc.attrs[1].glsl_name = "pos0";
+            desc.attrs[2].glsl_name = "size_scale0";
+            desc.attrs[3].glsl_name = "rot_depth0";
+            desc.attrs[4].glsl_name = "uv_rect0";
+            desc.attrs[5].glsl_name = "color_override0";
+            desc.attrs[6].glsl_name = "bytes0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 8;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[0].image_type = SG_IMAGETYPE_2D;
             desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -1023,16 +2512,86 @@ static inline const sg_shader_desc* quad_shader_desc(sg_backend backend) {
             desc.images[1].image_type = SG_IMAGETYPE_2D;
             desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.images[1].multisampled = false;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.images[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[4].image_type = SG_IMAGETYPE_2D;
+            desc.images[4].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[4].multisampled = false;
+            desc.images[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[5].image_type = SG_IMAGETYPE_2D;
+            desc.images[5].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[5].multisampled = false;
+            desc.images[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[6].image_type = SG_IMAGETYPE_2D;
+            desc.images[6].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[6].multisampled = false;
+            desc.images[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[7].image_type = SG_IMAGETYPE_2D;
+            desc.images[7].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[7].multisampled = false;
+            desc.images[8].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[8].image_type = SG_IMAGETYPE_ARRAY;
+            desc.images[8].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[8].multisampled = false;
+            desc.images[9].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[9].image_type = SG_IMAGETYPE_ARRAY;
+            desc.images[9].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[9].multisampled = false;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[0].image_slot = 0;
             desc.image_sampler_pairs[0].sampler_slot = 0;
-            desc.image_sampler_pairs[0].glsl_name = "texture0_default_sampler";
+            desc.image_sampler_pairs[0].glsl_name = "image0_default_sampler";
             desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[1].image_slot = 1;
             desc.image_sampler_pairs[1].sampler_slot = 0;
-            desc.image_sampler_pairs[1].glsl_name = "fontTex1_default_sampler";
+            desc.image_sampler_pairs[1].glsl_name = "image1_default_sampler";
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 0;
+            desc.image_sampler_pairs[2].glsl_name = "image2_default_sampler";
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 0;
+            desc.image_sampler_pairs[3].glsl_name = "image3_default_sampler";
+            desc.image_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[4].image_slot = 4;
+            desc.image_sampler_pairs[4].sampler_slot = 0;
+            desc.image_sampler_pairs[4].glsl_name = "image4_default_sampler";
+            desc.image_sampler_pairs[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[5].image_slot = 5;
+            desc.image_sampler_pairs[5].sampler_slot = 0;
+            desc.image_sampler_pairs[5].glsl_name = "image5_default_sampler";
+            desc.image_sampler_pairs[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[6].image_slot = 6;
+            desc.image_sampler_pairs[6].sampler_slot = 0;
+            desc.image_sampler_pairs[6].glsl_name = "image6_default_sampler";
+            desc.image_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[7].image_slot = 7;
+            desc.image_sampler_pairs[7].sampler_slot = 0;
+            desc.image_sampler_pairs[7].glsl_name = "image7_default_sampler";
+            desc.image_sampler_pairs[8].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[8].image_slot = 8;
+            desc.image_sampler_pairs[8].sampler_slot = 0;
+            desc.image_sampler_pairs[8].glsl_name = "fontPages8_default_sampler";
+            desc.image_sampler_pairs[9].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[9].image_slot = 9;
+            desc.image_sampler_pairs[9].sampler_slot = 0;
+            desc.image_sampler_pairs[9].glsl_name = "atlasPages9_default_sampler";
+            desc.image_sampler_pairs[10].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[10].image_slot = 8;
+            desc.image_sampler_pairs[10].sampler_slot = 1;
+            desc.image_sampler_pairs[10].glsl_name = "fontPages8_glyph_sampler";
             desc.label = "quad_shader";
         }
         return &desc;
@@ -1058,6 +2617,14 @@ static inline const sg_shader_desc* quad_shader_desc(sg_backend backend) {
             desc.attrs[3].hlsl_sem_index = 3;
             desc.attrs[4].hlsl_sem_name = "TEXCOORD";
             desc.attrs[4].hlsl_sem_index = 4;
+            desc.attrs[5].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[5].hlsl_sem_index = 5;
+            desc.attrs[6].hlsl_sem_name = "TEXCOORD";
+            desc.attrs[6].hlsl_sem_index = 6;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
             desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[0].image_type = SG_IMAGETYPE_2D;
             desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -1068,15 +2635,85 @@ static inline const sg_shader_desc* quad_shader_desc(sg_backend backend) {
             desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.images[1].multisampled = false;
             desc.images[1].hlsl_register_t_n = 1;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[2].hlsl_register_t_n = 2;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.images[3].hlsl_register_t_n = 3;
+            desc.images[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[4].image_type = SG_IMAGETYPE_2D;
+            desc.images[4].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[4].multisampled = false;
+            desc.images[4].hlsl_register_t_n = 4;
+            desc.images[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[5].image_type = SG_IMAGETYPE_2D;
+            desc.images[5].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[5].multisampled = false;
+            desc.images[5].hlsl_register_t_n = 5;
+            desc.images[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[6].image_type = SG_IMAGETYPE_2D;
+            desc.images[6].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[6].multisampled = false;
+            desc.images[6].hlsl_register_t_n = 6;
+            desc.images[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[7].image_type = SG_IMAGETYPE_2D;
+            desc.images[7].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[7].multisampled = false;
+            desc.images[7].hlsl_register_t_n = 7;
+            desc.images[8].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[8].image_type = SG_IMAGETYPE_ARRAY;
+            desc.images[8].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[8].multisampled = false;
+            desc.images[8].hlsl_register_t_n = 8;
+            desc.images[9].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[9].image_type = SG_IMAGETYPE_ARRAY;
+            desc.images[9].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[9].multisampled = false;
+            desc.images[9].hlsl_register_t_n = 9;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.samplers[0].hlsl_register_s_n = 0;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].hlsl_register_s_n = 1;
             desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[0].image_slot = 0;
             desc.image_sampler_pairs[0].sampler_slot = 0;
             desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[1].image_slot = 1;
             desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 0;
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 0;
+            desc.image_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[4].image_slot = 4;
+            desc.image_sampler_pairs[4].sampler_slot = 0;
+            desc.image_sampler_pairs[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[5].image_slot = 5;
+            desc.image_sampler_pairs[5].sampler_slot = 0;
+            desc.image_sampler_pairs[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[6].image_slot = 6;
+            desc.image_sampler_pairs[6].sampler_slot = 0;
+            desc.image_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[7].image_slot = 7;
+            desc.image_sampler_pairs[7].sampler_slot = 0;
+            desc.image_sampler_pairs[8].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[8].image_slot = 8;
+            desc.image_sampler_pairs[8].sampler_slot = 0;
+            desc.image_sampler_pairs[9].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[9].image_slot = 9;
+            desc.image_sampler_pairs[9].sampler_slot = 0;
+            desc.image_sampler_pairs[10].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[10].image_slot = 8;
+            desc.image_sampler_pairs[10].sampler_slot = 1;
             desc.label = "quad_shader";
         }
         return &desc;
@@ -1090,6 +2727,10 @@ static inline const sg_shader_desc* quad_shader_desc(sg_backend backend) {
             desc.vertex_func.entry = "main0";
             desc.fragment_func.source = (const char*)fs_source_metal_macos;
             desc.fragment_func.entry = "main0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
             desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[0].image_type = SG_IMAGETYPE_2D;
             desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -1100,15 +2741,85 @@ static inline const sg_shader_desc* quad_shader_desc(sg_backend backend) {
             desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.images[1].multisampled = false;
             desc.images[1].msl_texture_n = 1;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[2].msl_texture_n = 2;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.images[3].msl_texture_n = 3;
+            desc.images[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[4].image_type = SG_IMAGETYPE_2D;
+            desc.images[4].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[4].multisampled = false;
+            desc.images[4].msl_texture_n = 4;
+            desc.images[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[5].image_type = SG_IMAGETYPE_2D;
+            desc.images[5].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[5].multisampled = false;
+            desc.images[5].msl_texture_n = 5;
+            desc.images[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[6].image_type = SG_IMAGETYPE_2D;
+            desc.images[6].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[6].multisampled = false;
+            desc.images[6].msl_texture_n = 6;
+            desc.images[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[7].image_type = SG_IMAGETYPE_2D;
+            desc.images[7].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[7].multisampled = false;
+            desc.images[7].msl_texture_n = 7;
+            desc.images[8].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[8].image_type = SG_IMAGETYPE_ARRAY;
+            desc.images[8].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[8].multisampled = false;
+            desc.images[8].msl_texture_n = 8;
+            desc.images[9].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[9].image_type = SG_IMAGETYPE_ARRAY;
+            desc.images[9].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[9].multisampled = false;
+            desc.images[9].msl_texture_n = 9;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.samplers[0].msl_sampler_n = 0;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].msl_sampler_n = 1;
             desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[0].image_slot = 0;
             desc.image_sampler_pairs[0].sampler_slot = 0;
             desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[1].image_slot = 1;
             desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 0;
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 0;
+            desc.image_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[4].image_slot = 4;
+            desc.image_sampler_pairs[4].sampler_slot = 0;
+            desc.image_sampler_pairs[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[5].image_slot = 5;
+            desc.image_sampler_pairs[5].sampler_slot = 0;
+            desc.image_sampler_pairs[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[6].image_slot = 6;
+            desc.image_sampler_pairs[6].sampler_slot = 0;
+            desc.image_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[7].image_slot = 7;
+            desc.image_sampler_pairs[7].sampler_slot = 0;
+            desc.image_sampler_pairs[8].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[8].image_slot = 8;
+            desc.image_sampler_pairs[8].sampler_slot = 0;
+            desc.image_sampler_pairs[9].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[9].image_slot = 9;
+            desc.image_sampler_pairs[9].sampler_slot = 0;
+            desc.image_sampler_pairs[10].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[10].image_slot = 8;
+            desc.image_sampler_pairs[10].sampler_slot = 1;
             desc.label = "quad_shader";
         }
         return &desc;
@@ -1122,6 +2833,10 @@ static inline const sg_shader_desc* quad_shader_desc(sg_backend backend) {
             desc.vertex_func.entry = "main";
             desc.fragment_func.source = (const char*)fs_source_wgsl;
             desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
             desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[0].image_type = SG_IMAGETYPE_2D;
             desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -1132,15 +2847,85 @@ static inline const sg_shader_desc* quad_shader_desc(sg_backend backend) {
             desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
             desc.images[1].multisampled = false;
             desc.images[1].wgsl_group1_binding_n = 65;
+            desc.images[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[2].image_type = SG_IMAGETYPE_2D;
+            desc.images[2].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[2].multisampled = false;
+            desc.images[2].wgsl_group1_binding_n = 66;
+            desc.images[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[3].image_type = SG_IMAGETYPE_2D;
+            desc.images[3].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[3].multisampled = false;
+            desc.images[3].wgsl_group1_binding_n = 67;
+            desc.images[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[4].image_type = SG_IMAGETYPE_2D;
+            desc.images[4].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[4].multisampled = false;
+            desc.images[4].wgsl_group1_binding_n = 68;
+            desc.images[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[5].image_type = SG_IMAGETYPE_2D;
+            desc.images[5].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[5].multisampled = false;
+            desc.images[5].wgsl_group1_binding_n = 69;
+            desc.images[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[6].image_type = SG_IMAGETYPE_2D;
+            desc.images[6].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[6].multisampled = false;
+            desc.images[6].wgsl_group1_binding_n = 70;
+            desc.images[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[7].image_type = SG_IMAGETYPE_2D;
+            desc.images[7].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[7].multisampled = false;
+            desc.images[7].wgsl_group1_binding_n = 71;
+            desc.images[8].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[8].image_type = SG_IMAGETYPE_ARRAY;
+            desc.images[8].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[8].multisampled = false;
+            desc.images[8].wgsl_group1_binding_n = 72;
+            desc.images[9].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[9].image_type = SG_IMAGETYPE_ARRAY;
+            desc.images[9].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[9].multisampled = false;
+            desc.images[9].wgsl_group1_binding_n = 73;
             desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
             desc.samplers[0].wgsl_group1_binding_n = 80;
+            desc.samplers[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[1].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.samplers[1].wgsl_group1_binding_n = 81;
             desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[0].image_slot = 0;
             desc.image_sampler_pairs[0].sampler_slot = 0;
             desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.image_sampler_pairs[1].image_slot = 1;
             desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[2].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[2].image_slot = 2;
+            desc.image_sampler_pairs[2].sampler_slot = 0;
+            desc.image_sampler_pairs[3].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[3].image_slot = 3;
+            desc.image_sampler_pairs[3].sampler_slot = 0;
+            desc.image_sampler_pairs[4].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[4].image_slot = 4;
+            desc.image_sampler_pairs[4].sampler_slot = 0;
+            desc.image_sampler_pairs[5].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[5].image_slot = 5;
+            desc.image_sampler_pairs[5].sampler_slot = 0;
+            desc.image_sampler_pairs[6].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[6].image_slot = 6;
+            desc.image_sampler_pairs[6].sampler_slot = 0;
+            desc.image_sampler_pairs[7].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[7].image_slot = 7;
+            desc.image_sampler_pairs[7].sampler_slot = 0;
+            desc.image_sampler_pairs[8].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[8].image_slot = 8;
+            desc.image_sampler_pairs[8].sampler_slot = 0;
+            desc.image_sampler_pairs[9].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[9].image_slot = 9;
+            desc.image_sampler_pairs[9].sampler_slot = 0;
+            desc.image_sampler_pairs[10].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[10].image_slot = 8;
+            desc.image_sampler_pairs[10].sampler_slot = 1;
             desc.label = "quad_shader";
         }
         return &desc;
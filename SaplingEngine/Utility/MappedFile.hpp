@@ -0,0 +1,46 @@
+//
+//  MappedFile.hpp
+//  SaplingEngine
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/*
+    * Read only memory mapping of a whole file, unmapped when destroyed.
+*/
+class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /*
+            * Maps a file, unmapping the previous one
+            * @param path The path to the file
+            * @return False if the file can't be opened or is empty
+        */
+        auto open(const std::string& path) -> bool;
+
+        /*
+            * Unmaps the file, does nothing if nothing is mapped
+        */
+        void close();
+
+        auto data() const -> const unsigned char* { return m_data; }
+        auto size() const -> size_t { return m_size; }
+        auto isOpen() const -> bool { return m_data != nullptr; }
+
+    private:
+        const unsigned char* m_data = nullptr;
+        size_t m_size = 0;
+
+        #ifdef _WIN32
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+        #endif
+};
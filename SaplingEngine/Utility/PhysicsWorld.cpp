@@ -0,0 +1,732 @@
+//
+//  PhysicsWorld.cpp
+//  SaplingEngine, Twig Physics
+//
+
+#include "Utility/PhysicsWorld.hpp"
+#include "ECS/EntityManager.hpp"
+#include "Renderer/Sprout.hpp"
+#include "Core/JobSystem.hpp"
+
+#include <algorithm>
+#include <limits>
+
+
+auto PhysicsWorld::makeBody(const std::shared_ptr<Entity>& entity) -> Body
+{
+    auto& transform = entity->getComponent<Comp::Transform>();
+    auto& bbox = entity->getComponent<Comp::BBox>();
+
+    // same placement as Physics2D::collisionData
+    const glm::vec2 scaledSize = glm::vec2(bbox.w, bbox.h) * glm::abs(glm::vec2(transform.scale.x, transform.scale.y));
+    const glm::vec2 pivotOffset = scaledSize * (Sprout::getPivotOffset(transform.pivot) - glm::vec2(0.5f));
+
+    Body body;
+    body.entity = entity;
+    body.transform = &transform;
+    body.bbox = &bbox;
+    body.id = entity->getId();
+    body.center = transform.position + pivotOffset;
+    body.startCenter = body.center;
+    body.halfSize = scaledSize * 0.5f;
+    body.velocity = transform.velocity;
+    body.isStatic = bbox.isStatic;
+    body.isTrigger = bbox.isTrigger;
+    body.interactWithTriggers = bbox.interactWithTriggers;
+    body.sleeping = !bbox.isStatic && bbox.sleeping;
+    return body;
+}
+
+auto PhysicsWorld::isGridTile(const std::shared_ptr<Entity>& entity) -> bool
+{
+    const auto& bbox = entity->getComponent<Comp::BBox>();
+    return entity->hasComponent<Comp::GridTransform>() && !bbox.isTrigger && !bbox.collisionEventsEnabled;
+}
+
+void PhysicsWorld::bakeGridTile(const std::shared_ptr<Entity>& entity)
+{
+    // the Transform only follows the grid once the entity is rendered, so place the box at its cell
+    Body body = makeBody(entity);
+    body.center += entity->getComponent<Comp::GridTransform>().getWorldPosition() - entity->getComponent<Comp::Transform>().position;
+
+    // boxes that line up with cell edges cover exactly those cells, not the neighbours they touch
+    const float epsilon = 0.01f;
+    const glm::ivec2 first = m_tileLayer.worldToTile(body.center - body.halfSize + epsilon);
+    const glm::ivec2 last = m_tileLayer.worldToTile(body.center + body.halfSize - epsilon);
+    for (int y = first.y; y <= last.y; y++)
+    {
+        for (int x = first.x; x <= last.x; x++)
+        {
+            m_tileLayer.setBaked(x, y);
+        }
+    }
+}
+
+auto PhysicsWorld::wantsContact(const Body& b0, const Body& b1) -> bool
+{
+    if (b0.isStatic && b1.isStatic)
+    {
+        return false;
+    }
+    if (b0.isTrigger || b1.isTrigger)
+    {
+        // trigger pairs only matter if the other side listens for triggers
+        return (b0.isTrigger && b1.interactWithTriggers) || (b1.isTrigger && b0.interactWithTriggers);
+    }
+    return true;
+}
+
+void PhysicsWorld::step(EntityManager& entityManager, float dt)
+{
+    gatherBodies(entityManager);
+    if (m_staticDirty)
+    {
+        bakeStatic(entityManager);
+    }
+    if (m_wakeAllPending)
+    {
+        wakeAll();
+    }
+    integrate(dt);
+    broadphase(entityManager.getSpatialGrid());
+    narrowphase();
+    solveIslands(dt);
+    diffContacts();
+    dispatchEvents();
+}
+
+auto PhysicsWorld::getSettings() -> Settings&
+{
+    return m_settings;
+}
+
+void PhysicsWorld::gatherBodies(EntityManager& entityManager)
+{
+    m_bodies.clear();
+    m_bodyIndex.clear();
+
+    std::vector<uint32_t> islandsToWake;
+    const float wakeSpeed2 = m_settings.sleepVelocity * m_settings.sleepVelocity;
+
+    size_t staticCursor = 0;
+    for (const auto& e : entityManager.getEntities("hascollider"))
+    {
+        if (!e->isActive() || !e->hasComponent<Comp::Transform>() || !e->hasComponentEnabled<Comp::BBox>())
+        {
+            continue;
+        }
+
+        auto& bbox = e->getComponent<Comp::BBox>();
+        if (bbox.isStatic)
+        {
+            // statics are expected in the same order as when they were baked
+            if (staticCursor >= m_staticOrder.size() || m_staticOrder[staticCursor] != e->getId())
+            {
+                m_staticDirty = true;
+            }
+            staticCursor++;
+            continue;
+        }
+
+        if (bbox.sleeping)
+        {
+            // moved, pushed or no longer allowed to sleep since it went down
+            const auto& transform = e->getComponent<Comp::Transform>();
+            if (!bbox.canSleep || !m_settings.allowSleeping
+                || transform.position != bbox.sleepPosition
+                || glm::dot(transform.velocity, transform.velocity) > wakeSpeed2)
+            {
+                bbox.wake();
+            }
+        }
+        if (!bbox.sleeping && bbox.sleepIsland != 0)
+        {
+            // woken since the last step, take the rest of the island with it
+            islandsToWake.push_back(bbox.sleepIsland);
+            bbox.sleepIsland = 0;
+        }
+
+        m_bodyIndex[e->getId()] = m_bodies.size();
+        m_bodies.push_back(makeBody(e));
+    }
+
+    if (staticCursor != m_staticOrder.size())
+    {
+        m_staticDirty = true;
+    }
+
+    for (uint32_t island : islandsToWake)
+    {
+        wakeIsland(island);
+    }
+}
+
+void PhysicsWorld::bakeStatic(EntityManager& entityManager)
+{
+    m_staticBodies.clear();
+    m_staticOrder.clear();
+    m_staticIndex.clear();
+    m_tileLayer.clearBaked();
+
+    for (const auto& e : entityManager.getEntities("hascollider"))
+    {
+        if (!e->isActive() || !e->hasComponent<Comp::Transform>() || !e->hasComponentEnabled<Comp::BBox>())
+        {
+            continue;
+        }
+        if (e->getComponent<Comp::BBox>().isStatic)
+        {
+            // tiles stay in the order so adding or removing one still triggers a rebake
+            m_staticOrder.push_back(e->getId());
+            if (m_bakeGridTiles && isGridTile(e))
+            {
+                bakeGridTile(e);
+                continue;
+            }
+            m_staticIndex[e->getId()] = m_staticBodies.size();
+            m_staticBodies.push_back(makeBody(e));
+        }
+    }
+
+    std::vector<StaticGrid::Box> boxes;
+    boxes.reserve(m_staticBodies.size());
+    for (const auto& body : m_staticBodies)
+    {
+        boxes.push_back({body.center - body.halfSize, body.center + body.halfSize});
+    }
+    m_staticGrid.build(std::move(boxes));
+
+    m_staticDirty = false;
+    // whatever rested on the old statics has to look again
+    m_wakeAllPending = true;
+}
+
+void PhysicsWorld::markStaticDirty()
+{
+    m_staticDirty = true;
+}
+
+void PhysicsWorld::setBakeGridTiles(bool enabled)
+{
+    if (enabled != m_bakeGridTiles)
+    {
+        m_bakeGridTiles = enabled;
+        m_staticDirty = true;
+    }
+}
+
+void PhysicsWorld::wakeBody(Body& body)
+{
+    body.sleeping = false;
+    body.bbox->wake();
+    body.bbox->sleepIsland = 0;
+}
+
+void PhysicsWorld::wakeIsland(uint32_t island)
+{
+    const auto it = m_sleepingIslands.find(island);
+    if (it == m_sleepingIslands.end())
+    {
+        return;
+    }
+    for (size_t id : it->second)
+    {
+        // members destroyed while asleep are simply gone from m_bodyIndex
+        const auto body = m_bodyIndex.find(id);
+        if (body != m_bodyIndex.end())
+        {
+            wakeBody(m_bodies[body->second]);
+        }
+    }
+    m_sleepingIslands.erase(it);
+}
+
+void PhysicsWorld::wakeAll()
+{
+    for (auto& body : m_bodies)
+    {
+        if (body.sleeping || body.bbox->sleepIsland != 0)
+        {
+            wakeBody(body);
+        }
+    }
+    m_sleepingIslands.clear();
+    m_wakeAllPending = false;
+}
+
+void PhysicsWorld::integrate(float dt)
+{
+    if (!m_settings.integrateVelocity || dt <= 0.0f)
+    {
+        return;
+    }
+
+    for (auto& body : m_bodies)
+    {
+        if (body.sleeping || (body.velocity.x == 0.0f && body.velocity.y == 0.0f))
+        {
+            continue;
+        }
+
+        const auto result = m_tileLayer.sweep(body.center, body.halfSize, body.velocity * dt);
+        body.center += result.delta;
+        body.transform->position += result.delta;
+        if (result.hitX) body.velocity.x = 0.0f;
+        if (result.hitY) body.velocity.y = 0.0f;
+        body.transform->velocity = body.velocity;
+    }
+}
+
+void PhysicsWorld::broadphase(SpatialGrid& grid)
+{
+    m_candidates.clear();
+
+    auto addCandidate = [this](Body& x, Body& y)
+    {
+        if (x.id < y.id)
+        {
+            m_candidates.push_back({{x.id, y.id}, &x, &y});
+        }
+        else
+        {
+            m_candidates.push_back({{y.id, x.id}, &y, &x});
+        }
+    };
+
+    // only awake movers pay for grid maintenance, sleepers stay where they were inserted
+    for (const auto& body : m_bodies)
+    {
+        if (!body.sleeping)
+        {
+            grid.updateEntity(body.entity);
+        }
+    }
+
+    for (auto& body : m_bodies)
+    {
+        if (body.sleeping)
+        {
+            continue;
+        }
+
+        for (const auto& other : grid.getPotentialCollisions(body.entity))
+        {
+            // statics the game put in the grid itself aren't in m_bodyIndex and are skipped here
+            const auto it = m_bodyIndex.find(other->getId());
+            if (it == m_bodyIndex.end())
+            {
+                continue;
+            }
+            Body& otherBody = m_bodies[it->second];
+
+            // an awake pair is seen from both sides, keep it once; a sleeper never queries so keep it always
+            if (!otherBody.sleeping && otherBody.id < body.id)
+            {
+                continue;
+            }
+            addCandidate(body, otherBody);
+        }
+
+        m_staticGrid.query(body.center - body.halfSize, body.center + body.halfSize, [&](uint32_t index)
+        {
+            addCandidate(body, m_staticBodies[index]);
+        });
+    }
+
+    std::sort(m_candidates.begin(), m_candidates.end());
+}
+
+auto PhysicsWorld::isResting(size_t id) const -> bool
+{
+    const auto it = m_bodyIndex.find(id);
+    if (it != m_bodyIndex.end())
+    {
+        return m_bodies[it->second].sleeping;
+    }
+    return m_staticIndex.count(id) != 0;
+}
+
+void PhysicsWorld::narrowphase()
+{
+    std::swap(m_contacts, m_previousContacts);
+    m_contacts.clear();
+    m_solverContacts.clear();
+
+    // contacts between sleepers (or a sleeper and a static) aren't tested, they are kept as they were.
+    // this is decided before anything wakes below, so an island woken this step keeps its inner contacts for one more step.
+    std::vector<Contact> carried;
+    for (const auto& contact : m_previousContacts)
+    {
+        if (isResting(contact.pair.idA) && isResting(contact.pair.idB))
+        {
+            carried.push_back(contact);
+        }
+    }
+
+    // candidates are cut into fixed chunks that only read bodies and write their own output,
+    // then merged in chunk order, so the contact list doesn't depend on the thread count
+    const size_t chunks = JobSystem::chunkCount(m_candidates.size(), NarrowphaseGrain);
+    if (m_narrowphaseChunks.size() < chunks)
+    {
+        m_narrowphaseChunks.resize(chunks);
+    }
+
+    parallelFor(m_candidates.size(), NarrowphaseGrain, [this](size_t chunk, size_t begin, size_t end)
+    {
+        NarrowphaseChunk& out = m_narrowphaseChunks[chunk];
+        out.contacts.clear();
+        out.solverContacts.clear();
+        out.wakes.clear();
+
+        for (size_t i = begin; i < end; i++)
+        {
+            const Candidate& candidate = m_candidates[i];
+            Body& b0 = *candidate.b0;
+            Body& b1 = *candidate.b1;
+
+            if (!wantsContact(b0, b1))
+            {
+                continue;
+            }
+
+            const glm::vec2 dr = b0.center - b1.center;
+            const glm::vec2 overlap = b0.halfSize + b1.halfSize - glm::abs(dr);
+
+            if (overlap.x <= 0 || overlap.y <= 0)
+            {
+                continue;
+            }
+
+            Contact contact;
+            contact.pair = candidate.pair;
+            contact.a = b0.entity;
+            contact.b = b1.entity;
+            contact.overlap = overlap;
+            contact.normal = (dr.x != 0 || dr.y != 0) ? glm::normalize(dr) : glm::vec2(0.0f, -1.0f);
+            contact.trigger = b0.isTrigger || b1.isTrigger;
+            out.contacts.push_back(contact);
+
+            if (!contact.trigger)
+            {
+                if (b0.sleeping) out.wakes.push_back(&b0);
+                if (b1.sleeping) out.wakes.push_back(&b1);
+                out.solverContacts.push_back({&b0, &b1, 0});
+            }
+        }
+    });
+
+    for (size_t chunk = 0; chunk < chunks; chunk++)
+    {
+        NarrowphaseChunk& out = m_narrowphaseChunks[chunk];
+        m_contacts.insert(m_contacts.end(), out.contacts.begin(), out.contacts.end());
+        m_solverContacts.insert(m_solverContacts.end(), out.solverContacts.begin(), out.solverContacts.end());
+
+        // an awake body touching a sleeper wakes the sleeper's whole island
+        for (Body* body : out.wakes)
+        {
+            if (body->sleeping)
+            {
+                const uint32_t island = body->bbox->sleepIsland;
+                wakeBody(*body);
+                wakeIsland(island);
+            }
+        }
+    }
+
+    // both runs are sorted by pair and never share one
+    const auto middle = static_cast<std::ptrdiff_t>(m_contacts.size());
+    m_contacts.insert(m_contacts.end(), carried.begin(), carried.end());
+    std::inplace_merge(m_contacts.begin(), m_contacts.begin() + middle, m_contacts.end(),
+        [](const Contact& x, const Contact& y) { return x.pair < y.pair; });
+}
+
+void PhysicsWorld::resolveContact(const SolverContact& contact)
+{
+    Body& b0 = *contact.b0;
+    Body& b1 = *contact.b1;
+
+    // earlier pushes in the island may already have separated the pair
+    const glm::vec2 dr = b0.center - b1.center;
+    const glm::vec2 overlap = b0.halfSize + b1.halfSize - glm::abs(dr);
+    if (overlap.x <= m_settings.contactSlop || overlap.y <= m_settings.contactSlop)
+    {
+        return;
+    }
+
+    // separate along the axis of least penetration, pushing b0 away from b1
+    const int axis = overlap.x < overlap.y ? 0 : 1;
+    const float direction = dr[axis] >= 0.0f ? 1.0f : -1.0f;
+    glm::vec2 push(0.0f);
+    push[axis] = (overlap[axis] - m_settings.contactSlop) * direction;
+
+    auto move = [this, axis](Body& body, const glm::vec2& delta, float away)
+    {
+        const auto result = m_tileLayer.sweep(body.center, body.halfSize, delta);
+        body.center += result.delta;
+        body.transform->position += result.delta;
+
+        // drop the velocity component still heading into the contact
+        if (body.velocity[axis] * away < 0.0f)
+        {
+            body.velocity[axis] = 0.0f;
+            body.transform->velocity = body.velocity;
+        }
+    };
+
+    if (b1.isStatic)
+    {
+        move(b0, push, direction);
+    }
+    else if (b0.isStatic)
+    {
+        move(b1, -push, -direction);
+    }
+    else
+    {
+        move(b0, push * 0.5f, direction);
+        move(b1, -push * 0.5f, -direction);
+    }
+}
+
+void PhysicsWorld::parallelFor(size_t count, size_t grainSize, const JobSystem::RangeJob& job) const
+{
+    if (m_settings.multithreaded)
+    {
+        JobSystem::parallelFor(count, grainSize, job);
+        return;
+    }
+    for (size_t chunk = 0; chunk < JobSystem::chunkCount(count, grainSize); chunk++)
+    {
+        job(chunk, chunk * grainSize, std::min(count, (chunk + 1) * grainSize));
+    }
+}
+
+auto PhysicsWorld::findIsland(uint32_t body) -> uint32_t
+{
+    while (m_bodies[body].island != body)
+    {
+        m_bodies[body].island = m_bodies[m_bodies[body].island].island;
+        body = m_bodies[body].island;
+    }
+    return body;
+}
+
+void PhysicsWorld::solveIslands(float dt)
+{
+    auto indexOf = [this](const Body* body) { return static_cast<uint32_t>(body - m_bodies.data()); };
+
+    // islands are the connected groups of awake dynamic bodies in solid contact, statics don't join them
+    for (uint32_t i = 0; i < m_bodies.size(); i++)
+    {
+        m_bodies[i].island = i;
+    }
+    for (const auto& contact : m_solverContacts)
+    {
+        if (!contact.b0->isStatic && !contact.b1->isStatic)
+        {
+            const uint32_t r0 = findIsland(indexOf(contact.b0));
+            const uint32_t r1 = findIsland(indexOf(contact.b1));
+            m_bodies[std::max(r0, r1)].island = std::min(r0, r1);
+        }
+    }
+    for (auto& contact : m_solverContacts)
+    {
+        contact.island = findIsland(indexOf(contact.b0->isStatic ? contact.b1 : contact.b0));
+    }
+
+    if (m_settings.resolveContacts)
+    {
+        std::stable_sort(m_solverContacts.begin(), m_solverContacts.end(),
+            [](const SolverContact& x, const SolverContact& y) { return x.island < y.island; });
+
+        m_islandStarts.clear();
+        for (size_t i = 0; i < m_solverContacts.size(); i++)
+        {
+            if (i == 0 || m_solverContacts[i].island != m_solverContacts[i - 1].island)
+            {
+                m_islandStarts.push_back(i);
+            }
+        }
+        m_islandStarts.push_back(m_solverContacts.size());
+
+        // islands share no dynamic bodies, each one is solved in contact order on a single thread
+        parallelFor(m_islandStarts.size() - 1, IslandGrain, [this](size_t, size_t begin, size_t end)
+        {
+            for (size_t island = begin; island < end; island++)
+            {
+                for (size_t i = m_islandStarts[island]; i < m_islandStarts[island + 1]; i++)
+                {
+                    resolveContact(m_solverContacts[i]);
+                }
+            }
+        });
+    }
+
+    if (!m_settings.allowSleeping)
+    {
+        return;
+    }
+
+    // a body is idle while both its velocity and what it actually moved this step stay under the threshold
+    const float sleepSpeed2 = m_settings.sleepVelocity * m_settings.sleepVelocity;
+    std::vector<float> islandIdle(m_bodies.size(), std::numeric_limits<float>::max());
+    for (uint32_t i = 0; i < m_bodies.size(); i++)
+    {
+        Body& body = m_bodies[i];
+        if (body.sleeping)
+        {
+            continue;
+        }
+
+        const glm::vec2 moved = dt > 0.0f ? (body.center - body.startCenter) / dt : glm::vec2(0.0f);
+        const bool idle = body.bbox->canSleep
+            && glm::dot(body.velocity, body.velocity) < sleepSpeed2
+            && glm::dot(moved, moved) < sleepSpeed2;
+        body.bbox->idleTime = idle ? body.bbox->idleTime + dt : 0.0f;
+
+        float& idleTime = islandIdle[findIsland(i)];
+        idleTime = std::min(idleTime, body.bbox->idleTime);
+    }
+
+    // islands go to sleep as a whole, once their most restless body has settled
+    std::unordered_map<uint32_t, uint32_t> sleepIds; // island root -> sleeping island id
+    for (uint32_t i = 0; i < m_bodies.size(); i++)
+    {
+        Body& body = m_bodies[i];
+        const uint32_t root = findIsland(i);
+        if (body.sleeping || islandIdle[root] < m_settings.sleepTime)
+        {
+            continue;
+        }
+
+        auto [it, inserted] = sleepIds.try_emplace(root, m_nextIslandId);
+        if (inserted)
+        {
+            m_nextIslandId = m_nextIslandId == std::numeric_limits<uint32_t>::max() ? 1 : m_nextIslandId + 1;
+        }
+
+        body.sleeping = true;
+        body.velocity = glm::vec2(0.0f);
+        body.transform->velocity = body.velocity;
+        body.bbox->sleeping = true;
+        body.bbox->sleepIsland = it->second;
+        body.bbox->sleepPosition = body.transform->position;
+        m_sleepingIslands[it->second].push_back(body.id);
+    }
+}
+
+void PhysicsWorld::diffContacts()
+{
+    for (auto& events : m_events)
+    {
+        events.clear();
+    }
+
+    auto emit = [this](const Contact& contact, ContactPhase phase)
+    {
+        ContactEvent event;
+        event.pair = contact.pair;
+        event.a = contact.a.lock();
+        event.b = contact.b.lock();
+        event.phase = phase;
+        event.trigger = contact.trigger;
+        m_events[static_cast<size_t>(phase)].push_back(std::move(event));
+    };
+
+    // both lists are sorted by pair, so one merge pass classifies every contact
+    auto current = m_contacts.begin();
+    auto previous = m_previousContacts.begin();
+    while (current != m_contacts.end() || previous != m_previousContacts.end())
+    {
+        if (previous == m_previousContacts.end() || (current != m_contacts.end() && current->pair < previous->pair))
+        {
+            emit(*current++, ContactPhase::Enter);
+        }
+        else if (current == m_contacts.end() || previous->pair < current->pair)
+        {
+            emit(*previous++, ContactPhase::Exit);
+        }
+        else
+        {
+            emit(*current, ContactPhase::Stay);
+            ++current;
+            ++previous;
+        }
+    }
+}
+
+void PhysicsWorld::dispatchEvents()
+{
+    static const std::array<const char*, 3> collisionNames = {"onCollisionEnter", "onCollisionStay", "onCollisionExit"};
+    static const std::array<const char*, 3> triggerNames = {"onTriggerEnter", "onTriggerStay", "onTriggerExit"};
+
+    auto notify = [](const std::shared_ptr<Entity>& self, const std::shared_ptr<Entity>& other, const char* name)
+    {
+        if (self && self->hasComponent<Comp::BBox>() && self->getComponent<Comp::BBox>().collisionEventsEnabled)
+        {
+            self->PushEvent(name, Inst(other));
+        }
+    };
+
+    for (size_t phase = 0; phase < m_events.size(); phase++)
+    {
+        for (const auto& event : m_events[phase])
+        {
+            const char* name = event.trigger ? triggerNames[phase] : collisionNames[phase];
+            notify(event.a, event.b, name);
+            notify(event.b, event.a, name);
+        }
+    }
+}
+
+auto PhysicsWorld::getTileLayer() -> TileCollisionLayer&
+{
+    return m_tileLayer;
+}
+
+auto PhysicsWorld::moveAndCollide(const std::shared_ptr<Entity>& entity, const glm::vec2& delta) -> TileCollisionLayer::MoveResult
+{
+    const Body body = makeBody(entity);
+    const auto result = m_tileLayer.sweep(body.center, body.halfSize, delta);
+    entity->getComponent<Comp::Transform>().position += result.delta;
+    return result;
+}
+
+auto PhysicsWorld::getContacts() const -> const std::vector<Contact>&
+{
+    return m_contacts;
+}
+
+auto PhysicsWorld::getEvents(ContactPhase phase) const -> const std::vector<ContactEvent>&
+{
+    return m_events[static_cast<size_t>(phase)];
+}
+
+auto PhysicsWorld::isTouching(size_t idA, size_t idB) const -> bool
+{
+    const ContactPair key = {std::min(idA, idB), std::max(idA, idB)};
+    const auto it = std::lower_bound(m_contacts.begin(), m_contacts.end(), key,
+        [](const Contact& contact, const ContactPair& pair) { return contact.pair < pair; });
+    return it != m_contacts.end() && it->pair == key;
+}
+
+void PhysicsWorld::clear()
+{
+    m_bodies.clear();
+    m_bodyIndex.clear();
+    m_staticBodies.clear();
+    m_staticOrder.clear();
+    m_staticIndex.clear();
+    m_staticGrid.clear();
+    m_staticDirty = true;
+    m_sleepingIslands.clear();
+    m_candidates.clear();
+    m_solverContacts.clear();
+    m_narrowphaseChunks.clear();
+    m_contacts.clear();
+    m_previousContacts.clear();
+    for (auto& events : m_events)
+    {
+        events.clear();
+    }
+}
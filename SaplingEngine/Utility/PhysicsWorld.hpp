@@ -0,0 +1,286 @@
+//
+//  PhysicsWorld.hpp
+//  SaplingEngine, Twig Physics
+//
+
+#pragma once
+
+#include "ECS/Entity.hpp"
+#include "ECS/Component.hpp"
+#include "Core/JobSystem.hpp"
+#include "Utility/SpatialGrid.hpp"
+#include "Utility/StaticGrid.hpp"
+#include "Utility/TileCollision.hpp"
+
+#include "glm/glm.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+
+class Entity;
+class EntityManager;
+
+class PhysicsWorld
+{
+    public:
+
+        enum class ContactPhase : std::uint8_t
+        {
+            Enter,
+            Stay,
+            Exit,
+            Count
+        };
+
+        /*
+            * A pair of colliders keyed by entity id, always stored with idA < idB.
+        */
+        struct ContactPair
+        {
+            size_t idA = 0;
+            size_t idB = 0;
+
+            bool operator<(const ContactPair& other) const
+            {
+                return idA != other.idA ? idA < other.idA : idB < other.idB;
+            }
+            bool operator==(const ContactPair& other) const
+            {
+                return idA == other.idA && idB == other.idB;
+            }
+        };
+
+        /*
+            * An overlapping pair found during a step.
+            * normal (vec2): Direction from b's center to a's center.
+            * overlap (vec2): Penetration depth on each axis.
+            * trigger (bool): True if either collider is a trigger.
+        */
+        struct Contact
+        {
+            ContactPair pair;
+            std::weak_ptr<Entity> a;
+            std::weak_ptr<Entity> b;
+            glm::vec2 overlap = glm::vec2(0.0f);
+            glm::vec2 normal = glm::vec2(0.0f);
+            bool trigger = false;
+        };
+
+        /*
+            * A contact state change. On exit either entity may already be destroyed, in which case it is null.
+        */
+        struct ContactEvent
+        {
+            ContactPair pair;
+            std::shared_ptr<Entity> a;
+            std::shared_ptr<Entity> b;
+            ContactPhase phase = ContactPhase::Enter;
+            bool trigger = false;
+        };
+
+        /*
+            * Tuning for PhysicsWorld::step.
+            * integrateVelocity (bool): Move awake dynamic bodies by Transform::velocity * dt, swept against the tile layer.
+            * resolveContacts (bool): Push dynamic bodies out of solid contacts.
+            * contactSlop (f32): Penetration in pixels left in place when resolving, so resting contacts persist instead of flickering.
+            * allowSleeping (bool): Put islands of idle bodies to sleep.
+            * sleepVelocity (f32): Speed in pixels per second below which a body counts as idle.
+            * sleepTime (f32): Seconds every body in an island has to be idle before the island sleeps.
+            * multithreaded (bool): Run narrowphase and island solving on the JobSystem. Results are the same either way.
+        */
+        struct Settings
+        {
+            bool integrateVelocity = true;
+            bool resolveContacts = true;
+            float contactSlop = 0.05f;
+            bool allowSleeping = true;
+            float sleepVelocity = 4.0f;
+            float sleepTime = 0.5f;
+            bool multithreaded = true;
+        };
+
+        /*
+            * Advances every entity tagged "hascollider": integrates awake dynamic bodies, finds contacts,
+            * resolves solid contacts island by island, puts idle islands to sleep, diffs the contacts
+            * against last step's and emits enter/stay/exit events.
+            * Static colliders are baked into a separate StaticGrid and only queried by dynamic bodies;
+            * the bake is redone when a static collider is added or removed.
+            * Sleeping bodies are skipped in integration, grid updates and narrowphase, their contacts are kept as they were.
+            * They wake with their whole island when touched by an awake body, moved, given velocity, or woken with BBox::wake.
+            * Entities with BBox::collisionEventsEnabled receive events through Entity::PushEvent as
+            * onCollisionEnter/Stay/Exit or onTriggerEnter/Stay/Exit with the other entity as argument.
+            * @param entityManager The entity manager holding the colliders
+            * @param dt The time step in seconds
+        */
+        void step(EntityManager& entityManager, float dt);
+
+        /*
+            * Gets the settings of the world
+            * @return The settings
+        */
+        auto getSettings() -> Settings&;
+
+        /*
+            * Bakes every static collider into the static acceleration structure.
+            * With grid tile baking on, see setBakeGridTiles, static colliders on the grid go into the tile layer instead.
+            * Called automatically by step when the set of static colliders changes; call it after loading a level to avoid doing it on the first frame.
+            * @param entityManager The entity manager holding the colliders
+        */
+        void bakeStatic(EntityManager& entityManager);
+
+        /*
+            * Forces a rebake on the next step. Static colliders are assumed not to move, call this after moving or resizing one.
+        */
+        void markStaticDirty();
+
+        /*
+            * Turns baking of grid tiles on or off, off by default. When on, solid static colliders with a Comp::GridTransform
+            * and no collision events of their own are level tiles: bakeStatic marks every cell their BBox covers at the
+            * GridTransform's cell as baked in the tile layer and leaves them out of the StaticGrid and the broadphase.
+            * Tiles make no contacts, so bodies touching them get no collision events from them, and they only block moves
+            * swept through the tile layer: a body moved by writing its Transform isn't pushed back out of one.
+            * @param enabled True to bake grid tiles, takes effect at the next bake
+        */
+        void setBakeGridTiles(bool enabled);
+
+        /*
+            * Gets the tile collision layer of the world. Tiles are matched to Comp::GridTransform cells.
+            * @return The tile layer
+        */
+        auto getTileLayer() -> TileCollisionLayer&;
+
+        /*
+            * Moves an entity's Transform by delta, sweeping its BBox against the tile layer one axis at a time.
+            * @param entity The entity to move, must have a Transform and a BBox
+            * @param delta The desired movement
+            * @return The allowed movement and which axes were blocked
+        */
+        auto moveAndCollide(const std::shared_ptr<Entity>& entity, const glm::vec2& delta) -> TileCollisionLayer::MoveResult;
+
+        /*
+            * Gets the contacts found by the last step, sorted by pair
+            * @return The list of contacts
+        */
+        auto getContacts() const -> const std::vector<Contact>&;
+
+        /*
+            * Gets the events of one phase emitted by the last step, sorted by pair
+            * @param phase The phase of the events
+            * @return The list of events
+        */
+        auto getEvents(ContactPhase phase) const -> const std::vector<ContactEvent>&;
+
+        /*
+            * Checks if two entities were touching after the last step
+            * @param idA The id of the first entity
+            * @param idB The id of the second entity
+            * @return True if the pair is in the contact cache
+        */
+        auto isTouching(size_t idA, size_t idB) const -> bool;
+
+        /*
+            * Drops all cached contacts and events without emitting exits
+        */
+        void clear();
+
+    private:
+
+        /*
+            * Per-step snapshot of a collider, so narrowphase doesn't go through component lookups.
+        */
+        struct Body
+        {
+            std::shared_ptr<Entity> entity;
+            Comp::Transform* transform = nullptr;
+            Comp::BBox* bbox = nullptr;
+            size_t id = 0;
+            glm::vec2 center = glm::vec2(0.0f);
+            glm::vec2 startCenter = glm::vec2(0.0f);
+            glm::vec2 halfSize = glm::vec2(0.0f);
+            glm::vec2 velocity = glm::vec2(0.0f);
+            bool isStatic = true;
+            bool isTrigger = false;
+            bool interactWithTriggers = false;
+            bool sleeping = false;
+            uint32_t island = 0; // union-find parent while solving
+        };
+
+        struct Candidate
+        {
+            ContactPair pair;
+            Body* b0 = nullptr;
+            Body* b1 = nullptr;
+
+            bool operator<(const Candidate& other) const { return pair < other.pair; }
+        };
+
+        struct SolverContact
+        {
+            Body* b0 = nullptr;
+            Body* b1 = nullptr;
+            uint32_t island = 0;
+        };
+
+        // narrowphase output of one chunk of candidates, merged in chunk order
+        struct NarrowphaseChunk
+        {
+            std::vector<Contact> contacts;
+            std::vector<SolverContact> solverContacts;
+            std::vector<Body*> wakes;
+        };
+
+        static constexpr size_t NarrowphaseGrain = 256; // candidates per job
+        static constexpr size_t IslandGrain = 16; // islands per job
+
+        Settings m_settings;
+
+        std::vector<Body> m_bodies; // dynamic bodies, gathered every step
+        std::unordered_map<size_t, size_t> m_bodyIndex; // entity id -> index into m_bodies
+
+        std::vector<Body> m_staticBodies; // static bodies, gathered on bake
+        std::vector<size_t> m_staticOrder; // ids of baked statics in collider list order, to detect changes
+        std::unordered_map<size_t, size_t> m_staticIndex; // entity id -> index into m_staticBodies
+        StaticGrid m_staticGrid;
+        bool m_staticDirty = true;
+        bool m_bakeGridTiles = false;
+        bool m_wakeAllPending = false;
+
+        TileCollisionLayer m_tileLayer = TileCollisionLayer(static_cast<float>(Comp::GridTransform::CellSize));
+
+        std::unordered_map<uint32_t, std::vector<size_t>> m_sleepingIslands; // island id -> entity ids
+        uint32_t m_nextIslandId = 1;
+
+        std::vector<Candidate> m_candidates;
+        std::vector<SolverContact> m_solverContacts;
+        std::vector<size_t> m_islandStarts; // solver contact index where each island begins, plus the end
+        std::vector<NarrowphaseChunk> m_narrowphaseChunks;
+        std::vector<Contact> m_contacts;
+        std::vector<Contact> m_previousContacts;
+        std::array<std::vector<ContactEvent>, static_cast<size_t>(ContactPhase::Count)> m_events;
+
+        void gatherBodies(EntityManager& entityManager);
+        void wakeBody(Body& body);
+        void wakeIsland(uint32_t island);
+        void wakeAll();
+        void integrate(float dt);
+        void broadphase(SpatialGrid& grid);
+        void narrowphase();
+        void solveIslands(float dt);
+        void resolveContact(const SolverContact& contact);
+        void parallelFor(size_t count, size_t grainSize, const JobSystem::RangeJob& job) const;
+        void diffContacts();
+        void dispatchEvents();
+
+        auto findIsland(uint32_t body) -> uint32_t;
+        auto isResting(size_t id) const -> bool;
+
+        static auto makeBody(const std::shared_ptr<Entity>& entity) -> Body;
+        static auto isGridTile(const std::shared_ptr<Entity>& entity) -> bool;
+        void bakeGridTile(const std::shared_ptr<Entity>& entity);
+        static auto wantsContact(const Body& b0, const Body& b1) -> bool;
+};
@@ -63,6 +63,10 @@ public:
         entityCells.clear();
     }
     
+    bool contains(size_t entityId) const {
+        return entityCells.find(entityId) != entityCells.end();
+    }
+    
     void updateEntity(const std::shared_ptr<Entity>& entity) {
         if (!entity->hasComponent<Comp::Transform>()) {
             return;
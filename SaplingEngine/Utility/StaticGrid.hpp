@@ -0,0 +1,160 @@
+//
+//  StaticGrid.hpp
+//  SaplingEngine, Twig Physics
+//
+
+#pragma once
+
+#include "glm/glm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/*
+    * Immutable dense grid over static AABBs, built once and then only queried.
+    * Cells are stored as ranges into one flat index array, so a query touches no hash maps
+    * and a box spanning several cells is reported once without any per-query bookkeeping.
+*/
+class StaticGrid {
+public:
+    struct Box {
+        glm::vec2 min;
+        glm::vec2 max;
+    };
+
+private:
+    std::vector<Box> boxes;
+    std::vector<uint32_t> cellStart; // cell i owns items[cellStart[i] .. cellStart[i + 1])
+    std::vector<uint32_t> items;
+    glm::vec2 origin = glm::vec2(0.0f);
+    float cellSize = 1.0f;
+    float inverseCellSize = 1.0f;
+    int width = 0;
+    int height = 0;
+
+    inline int cellX(float x) const {
+        return std::clamp(static_cast<int>(std::floor((x - origin.x) * inverseCellSize)), 0, width - 1);
+    }
+    inline int cellY(float y) const {
+        return std::clamp(static_cast<int>(std::floor((y - origin.y) * inverseCellSize)), 0, height - 1);
+    }
+
+public:
+    StaticGrid() = default;
+
+    /*
+        * Rebuilds the grid from the given boxes. Box indices in queries refer to this vector.
+        * @param newBoxes The static boxes to bake
+    */
+    void build(std::vector<Box> newBoxes) {
+        boxes = std::move(newBoxes);
+        cellStart.clear();
+        items.clear();
+        width = height = 0;
+
+        if (boxes.empty()) {
+            return;
+        }
+
+        glm::vec2 lo = boxes[0].min;
+        glm::vec2 hi = boxes[0].max;
+        glm::vec2 averageSize(0.0f);
+        for (const auto& box : boxes) {
+            lo = glm::min(lo, box.min);
+            hi = glm::max(hi, box.max);
+            averageSize += box.max - box.min;
+        }
+        averageSize /= static_cast<float>(boxes.size());
+
+        // cells about the size of a typical collider, grown until the grid stays proportional to the box count
+        cellSize = std::max(std::max(averageSize.x, averageSize.y), 1.0f);
+        const glm::vec2 extent = hi - lo;
+        const double maxCells = 4.0 * static_cast<double>(boxes.size()) + 1024.0;
+        while (std::ceil(extent.x / cellSize + 1.0) * std::ceil(extent.y / cellSize + 1.0) > maxCells) {
+            cellSize *= 2.0f;
+        }
+
+        origin = lo;
+        inverseCellSize = 1.0f / cellSize;
+        width = static_cast<int>(extent.x * inverseCellSize) + 1;
+        height = static_cast<int>(extent.y * inverseCellSize) + 1;
+
+        // count, prefix sum, fill
+        cellStart.assign(static_cast<size_t>(width) * height + 1, 0);
+        for (const auto& box : boxes) {
+            for (int y = cellY(box.min.y); y <= cellY(box.max.y); y++) {
+                for (int x = cellX(box.min.x); x <= cellX(box.max.x); x++) {
+                    cellStart[y * width + x + 1]++;
+                }
+            }
+        }
+        for (size_t i = 1; i < cellStart.size(); i++) {
+            cellStart[i] += cellStart[i - 1];
+        }
+
+        items.resize(cellStart.back());
+        std::vector<uint32_t> cursor(cellStart.begin(), cellStart.end() - 1);
+        for (uint32_t i = 0; i < boxes.size(); i++) {
+            const auto& box = boxes[i];
+            for (int y = cellY(box.min.y); y <= cellY(box.max.y); y++) {
+                for (int x = cellX(box.min.x); x <= cellX(box.max.x); x++) {
+                    items[cursor[y * width + x]++] = i;
+                }
+            }
+        }
+    }
+
+    void clear() {
+        build({});
+    }
+
+    bool empty() const {
+        return boxes.empty();
+    }
+
+    size_t size() const {
+        return boxes.size();
+    }
+
+    const Box& getBox(uint32_t index) const {
+        return boxes[index];
+    }
+
+    /*
+        * Calls visit(index) once for every box whose bounds overlap the query bounds.
+        * @param min The minimum corner of the query
+        * @param max The maximum corner of the query
+        * @param visit The callback to call for every overlapping box
+    */
+    template <typename Visitor>
+    void query(const glm::vec2& min, const glm::vec2& max, Visitor&& visit) const {
+        if (boxes.empty()) {
+            return;
+        }
+
+        const int startX = cellX(min.x);
+        const int startY = cellY(min.y);
+        const int endX = cellX(max.x);
+        const int endY = cellY(max.y);
+
+        for (int y = startY; y <= endY; y++) {
+            for (int x = startX; x <= endX; x++) {
+                const int cell = y * width + x;
+                for (uint32_t i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+                    const uint32_t index = items[i];
+                    const Box& box = boxes[index];
+                    if (box.max.x < min.x || box.min.x > max.x || box.max.y < min.y || box.min.y > max.y) {
+                        continue;
+                    }
+                    // report the box only from the first cell both it and the query cover
+                    if (x != std::max(startX, cellX(box.min.x)) || y != std::max(startY, cellY(box.min.y))) {
+                        continue;
+                    }
+                    visit(index);
+                }
+            }
+        }
+    }
+};
@@ -0,0 +1,114 @@
+//
+//  StaticSpriteCache.cpp
+//  SaplingEngine, Sprout Renderer
+//
+
+#include "Utility/StaticSpriteCache.hpp"
+
+#include <cmath>
+
+
+StaticSpriteCache::~StaticSpriteCache()
+{
+    clear();
+}
+
+auto StaticSpriteCache::isCached(const Entity& entity) -> bool
+{
+    const auto& sprite = entity.getComponent<Comp::Sprite>();
+    return sprite.isStatic
+        && sprite.type == Comp::Sprite::Type::Static
+        && sprite.layer == Comp::Layer::Background
+        && entity.hasComponent<Comp::Transform>();
+}
+
+void StaticSpriteCache::add(Entity& entity)
+{
+    const auto& sprite = entity.getComponent<Comp::Sprite>();
+    const glm::vec2 position = entity.getComponent<Comp::Transform>().position + sprite.transformOffset;
+
+    Chunk& chunk = m_chunks[chunkKey(position)];
+    chunk.gathered.push_back(Baked{ entity.getId(), position, sprite.texture.get(), sprite.currentFrame });
+    chunk.entities.push_back(&entity);
+}
+
+void StaticSpriteCache::draw(Sprout::Window& window)
+{
+    for (auto it = m_chunks.begin(); it != m_chunks.end();)
+    {
+        Chunk& chunk = it->second;
+        if (chunk.gathered.empty())
+        {
+            window.releaseStaticChunk(chunk.chunk);
+            it = m_chunks.erase(it);
+            continue;
+        }
+
+        if (chunk.dirty || chunk.gathered != chunk.baked)
+        {
+            rebuild(chunk, window);
+        }
+        window.draw_static_chunk(chunk.chunk);
+
+        chunk.gathered.clear();
+        chunk.entities.clear();
+        ++it;
+    }
+}
+
+void StaticSpriteCache::markDirty()
+{
+    for (auto& [key, chunk] : m_chunks)
+    {
+        chunk.dirty = true;
+    }
+}
+
+void StaticSpriteCache::clear()
+{
+    if (Sprout::Window* window = Sprout::Window::getInstance())
+    {
+        for (auto& [key, chunk] : m_chunks)
+        {
+            window->releaseStaticChunk(chunk.chunk);
+        }
+    }
+    m_chunks.clear();
+}
+
+void StaticSpriteCache::rebuild(Chunk& chunk, Sprout::Window& window)
+{
+    window.releaseStaticChunk(chunk.chunk);
+
+    // the same depth Scene::sRender would give the background layer, ordered within the chunk
+    const glm::f32 count = static_cast<glm::f32>(chunk.entities.size());
+    const glm::f32 layers = static_cast<glm::f32>(Comp::Layer::Count);
+
+    window.beginStaticChunk();
+    for (size_t i = 0; i < chunk.entities.size(); i++)
+    {
+        const Entity& entity = *chunk.entities[i];
+        const auto& sprite = entity.getComponent<Comp::Sprite>();
+        const auto& transform = entity.getComponent<Comp::Transform>();
+
+        glm::vec3 scale = transform.scale * sprite.scaleOffset;
+        if (sprite.flip_X)
+        {
+            scale.x *= -1;
+        }
+        const glm::f32 depth = 1 - (static_cast<glm::f32>(Comp::Layer::Background) + static_cast<glm::f32>(i) / count) / layers;
+
+        window.draw_sprite(sprite.texture, chunk.gathered[i].position, depth, transform.rotation, (int)sprite.currentFrame, sprite.color_override, scale, transform.pivot, true);
+    }
+    chunk.chunk = window.endStaticChunk();
+
+    chunk.baked = chunk.gathered;
+    chunk.dirty = false;
+}
+
+auto StaticSpriteCache::chunkKey(glm::vec2 position) -> uint64_t
+{
+    const int32_t x = static_cast<int32_t>(std::floor(position.x / ChunkSize));
+    const int32_t y = static_cast<int32_t>(std::floor(position.y / ChunkSize));
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
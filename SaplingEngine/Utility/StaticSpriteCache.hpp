@@ -0,0 +1,100 @@
+//
+//  StaticSpriteCache.hpp
+//  SaplingEngine, Sprout Renderer
+//
+
+#pragma once
+
+#include "ECS/Entity.hpp"
+#include "ECS/Component.hpp"
+#include "Renderer/Sprout.hpp"
+
+#include "glm/glm.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+
+class Entity;
+
+/*
+    * Bakes static background sprites into Sprout static chunks, one per ChunkSize square of the world,
+    * so tiles are drawn with one call per chunk instead of one sprite each.
+    * Sprites are gathered every frame with add and compared against what their chunk was baked from;
+    * a chunk is rebuilt only when a sprite in it was added, removed, moved or given another texture or frame.
+    * Other changes (color, scale, rotation) aren't tracked, call markDirty after making them.
+*/
+class StaticSpriteCache
+{
+    public:
+
+        static constexpr float ChunkSize = 512.0f; // world pixels per chunk side
+
+        StaticSpriteCache() = default;
+        ~StaticSpriteCache();
+        StaticSpriteCache(const StaticSpriteCache&) = delete;
+        StaticSpriteCache& operator=(const StaticSpriteCache&) = delete;
+
+        /*
+            * Checks if an entity's sprite belongs in a static chunk: marked static, not animated, on Layer::Background and in world space
+            * @param entity The entity, must have a Sprite
+            * @return True if the sprite should be added instead of drawn
+        */
+        static auto isCached(const Entity& entity) -> bool;
+
+        /*
+            * Gathers a cached sprite for this frame, call it for every one in draw order before draw
+            * @param entity The entity, only used until draw returns
+        */
+        void add(Entity& entity);
+
+        /*
+            * Rebuilds the chunks whose sprites changed since their bake, releases the ones left empty and draws the rest
+            * @param window The window to build and draw the chunks in
+        */
+        void draw(Sprout::Window& window);
+
+        /*
+            * Forces every chunk to be rebuilt on the next draw
+        */
+        void markDirty();
+
+        /*
+            * Releases every chunk
+        */
+        void clear();
+
+    private:
+
+        // what a sprite was baked from, enough to notice it changed
+        struct Baked
+        {
+            size_t id = 0;
+            glm::vec2 position = glm::vec2(0.0f);
+            const Sprout::Texture* texture = nullptr;
+            size_t frame = 0;
+
+            bool operator==(const Baked& other) const
+            {
+                return id == other.id && position == other.position && texture == other.texture && frame == other.frame;
+            }
+        };
+
+        struct Chunk
+        {
+            std::vector<Baked> baked;
+            std::vector<Baked> gathered; // this frame, compared with baked on draw
+            std::vector<Entity*> entities; // this frame, parallel to gathered
+            int chunk = -1; // the window's chunk id
+            bool dirty = true;
+        };
+
+        std::map<uint64_t, Chunk> m_chunks; // ordered so chunks are drawn in the same order every frame
+
+        void rebuild(Chunk& chunk, Sprout::Window& window);
+
+        static auto chunkKey(glm::vec2 position) -> uint64_t;
+};
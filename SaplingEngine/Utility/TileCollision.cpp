@@ -0,0 +1,246 @@
+//
+//  TileCollision.cpp
+//  SaplingEngine, Twig Physics
+//
+
+#include "Utility/TileCollision.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iterator>
+
+
+namespace
+{
+    // bits lo..hi (inclusive) set
+    inline uint32_t bitRange(int lo, int hi)
+    {
+        const uint32_t upper = hi >= 31 ? ~0u : ((1u << (hi + 1)) - 1u);
+        return upper & ~((1u << lo) - 1u);
+    }
+}
+
+TileCollisionLayer::TileCollisionLayer(float tileSize)
+    :   m_tileSize(tileSize),
+        m_inverseTileSize(1.0f / tileSize)
+    {}
+
+void TileCollisionLayer::setSolid(int x, int y, bool solid)
+{
+    writeTile(x, y, solid, false);
+}
+
+void TileCollisionLayer::setBaked(int x, int y, bool solid)
+{
+    writeTile(x, y, solid, true);
+}
+
+void TileCollisionLayer::writeTile(int x, int y, bool solid, bool baked)
+{
+    const uint64_t key = chunkKey(x >> 5, y >> 5);
+    const uint32_t bit = 1u << (x & (ChunkSize - 1));
+    const int row = y & (ChunkSize - 1);
+
+    auto it = m_chunks.find(key);
+    if (it == m_chunks.end())
+    {
+        if (!solid)
+        {
+            return;
+        }
+        it = m_chunks.emplace(key, Chunk()).first;
+    }
+
+    Chunk& chunk = it->second;
+    uint32_t& bits = baked ? chunk.bakedRows[row] : chunk.setRows[row];
+    bits = solid ? (bits | bit) : (bits & ~bit);
+
+    const uint32_t merged = chunk.setRows[row] | chunk.bakedRows[row];
+    chunk.solidCount += std::popcount(merged) - std::popcount(chunk.rows[row]);
+    chunk.rows[row] = merged;
+    if (chunk.solidCount == 0)
+    {
+        m_chunks.erase(it);
+    }
+}
+
+void TileCollisionLayer::clearBaked()
+{
+    for (auto it = m_chunks.begin(); it != m_chunks.end();)
+    {
+        Chunk& chunk = it->second;
+        chunk.solidCount = 0;
+        for (int row = 0; row < ChunkSize; row++)
+        {
+            chunk.bakedRows[row] = 0;
+            chunk.rows[row] = chunk.setRows[row];
+            chunk.solidCount += std::popcount(chunk.rows[row]);
+        }
+        it = chunk.solidCount == 0 ? m_chunks.erase(it) : std::next(it);
+    }
+}
+
+auto TileCollisionLayer::isSolid(int x, int y) const -> bool
+{
+    return (rowBits(x & ~(ChunkSize - 1), y) >> (x & (ChunkSize - 1))) & 1u;
+}
+
+auto TileCollisionLayer::worldToTile(const glm::vec2& position) const -> glm::ivec2
+{
+    return glm::ivec2(
+        static_cast<int>(std::floor(position.x * m_inverseTileSize)),
+        static_cast<int>(std::floor(position.y * m_inverseTileSize))
+    );
+}
+
+void TileCollisionLayer::clear()
+{
+    m_chunks.clear();
+}
+
+auto TileCollisionLayer::findChunk(int cx, int cy) const -> const Chunk*
+{
+    const auto it = m_chunks.find(chunkKey(cx, cy));
+    return it != m_chunks.end() ? &it->second : nullptr;
+}
+
+auto TileCollisionLayer::rowBits(int x0, int y) const -> uint32_t
+{
+    const Chunk* chunk = findChunk(x0 >> 5, y >> 5);
+    return chunk ? chunk->rows[y & (ChunkSize - 1)] : 0u;
+}
+
+auto TileCollisionLayer::firstSolidInRow(int y, int from, int to, int& column) const -> bool
+{
+    if (from <= to)
+    {
+        for (int x0 = from & ~(ChunkSize - 1); x0 <= to; x0 += ChunkSize)
+        {
+            const uint32_t bits = rowBits(x0, y) & bitRange(std::max(from, x0) - x0, std::min(to, x0 + ChunkSize - 1) - x0);
+            if (bits)
+            {
+                column = x0 + std::countr_zero(bits);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    for (int x0 = from & ~(ChunkSize - 1); x0 + ChunkSize - 1 >= to; x0 -= ChunkSize)
+    {
+        const uint32_t bits = rowBits(x0, y) & bitRange(std::max(to, x0) - x0, std::min(from, x0 + ChunkSize - 1) - x0);
+        if (bits)
+        {
+            column = x0 + (ChunkSize - 1) - std::countl_zero(bits);
+            return true;
+        }
+    }
+    return false;
+}
+
+auto TileCollisionLayer::anySolidInRow(int y, int x0, int x1) const -> bool
+{
+    int column = 0;
+    return firstSolidInRow(y, x0, x1, column);
+}
+
+auto TileCollisionLayer::overlaps(const glm::vec2& min, const glm::vec2& max) const -> bool
+{
+    const int x0 = static_cast<int>(std::floor(min.x * m_inverseTileSize));
+    const int x1 = static_cast<int>(std::ceil(max.x * m_inverseTileSize)) - 1;
+    const int y0 = static_cast<int>(std::floor(min.y * m_inverseTileSize));
+    const int y1 = static_cast<int>(std::ceil(max.y * m_inverseTileSize)) - 1;
+
+    for (int y = y0; y <= y1; y++)
+    {
+        if (anySolidInRow(y, x0, x1))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+auto TileCollisionLayer::sweepAxis(glm::vec2 min, glm::vec2 max, float delta, int axis, bool& hit) const -> float
+{
+    hit = false;
+    if (delta == 0.0f || m_chunks.empty())
+    {
+        return delta;
+    }
+
+    // tiles the box spans on the other axis; the box covers [min, max)
+    const int other = 1 - axis;
+    const int span0 = static_cast<int>(std::floor(min[other] * m_inverseTileSize));
+    const int span1 = static_cast<int>(std::ceil(max[other] * m_inverseTileSize)) - 1;
+
+    // tiles newly entered along the axis, ordered in the direction of travel
+    int from, to;
+    if (delta > 0)
+    {
+        from = static_cast<int>(std::ceil(max[axis] * m_inverseTileSize));
+        to = static_cast<int>(std::ceil((max[axis] + delta) * m_inverseTileSize)) - 1;
+        if (to < from) return delta;
+    }
+    else
+    {
+        from = static_cast<int>(std::floor(min[axis] * m_inverseTileSize)) - 1;
+        to = static_cast<int>(std::floor((min[axis] + delta) * m_inverseTileSize));
+        if (to > from) return delta;
+    }
+
+    int blocking = 0;
+    if (axis == 0)
+    {
+        // rows are packed along x, so each row answers "first solid column" with one bit scan per chunk
+        for (int y = span0; y <= span1; y++)
+        {
+            int column = 0;
+            if (firstSolidInRow(y, from, to, column))
+            {
+                blocking = hit ? (delta > 0 ? std::min(blocking, column) : std::max(blocking, column)) : column;
+                hit = true;
+                to = column; // later rows only need to beat this one
+            }
+        }
+    }
+    else
+    {
+        const int step = delta > 0 ? 1 : -1;
+        for (int y = from; y != to + step; y += step)
+        {
+            if (anySolidInRow(y, span0, span1))
+            {
+                blocking = y;
+                hit = true;
+                break;
+            }
+        }
+    }
+
+    if (!hit)
+    {
+        return delta;
+    }
+
+    // stop flush against the blocking tile
+    const float allowed = delta > 0
+        ? static_cast<float>(blocking) * m_tileSize - max[axis]
+        : static_cast<float>(blocking + 1) * m_tileSize - min[axis];
+    return delta > 0 ? std::clamp(allowed, 0.0f, delta) : std::clamp(allowed, delta, 0.0f);
+}
+
+auto TileCollisionLayer::sweep(const glm::vec2& center, const glm::vec2& halfSize, const glm::vec2& delta) const -> MoveResult
+{
+    MoveResult result;
+    glm::vec2 min = center - halfSize;
+    glm::vec2 max = center + halfSize;
+
+    result.delta.x = sweepAxis(min, max, delta.x, 0, result.hitX);
+    min.x += result.delta.x;
+    max.x += result.delta.x;
+
+    result.delta.y = sweepAxis(min, max, delta.y, 1, result.hitY);
+    return result;
+}
@@ -0,0 +1,138 @@
+//
+//  TileCollision.hpp
+//  SaplingEngine, Twig Physics
+//
+
+#pragma once
+
+#include "glm/glm.hpp"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+/*
+    * Solid/empty tile grid for level collision, stored as one bit per tile in 32x32 chunks.
+    * Tiles are not entities; a moving box only reads the bitmap rows it sweeps through,
+    * so the level size doesn't matter, only the tiles near moving bodies.
+    * Tile (x, y) covers [x, x + 1) * tileSize, matching Comp::GridTransform.
+*/
+class TileCollisionLayer
+{
+    public:
+        static constexpr int ChunkSize = 32;
+
+        /*
+            * Result of a swept move.
+            * delta (vec2): The distance actually moved.
+            * hitX (bool): True if the move was blocked on the x axis.
+            * hitY (bool): True if the move was blocked on the y axis.
+        */
+        struct MoveResult
+        {
+            glm::vec2 delta = glm::vec2(0.0f);
+            bool hitX = false;
+            bool hitY = false;
+        };
+
+        explicit TileCollisionLayer(float tileSize = 32.0f);
+
+        /*
+            * Marks a tile as solid or empty
+            * @param x The tile column
+            * @param y The tile row
+            * @param solid Whether the tile blocks movement
+        */
+        void setSolid(int x, int y, bool solid = true);
+
+        /*
+            * Checks if a tile is solid
+            * @param x The tile column
+            * @param y The tile row
+            * @return True if the tile is solid
+        */
+        auto isSolid(int x, int y) const -> bool;
+
+        /*
+            * Marks a tile as solid or empty on behalf of PhysicsWorld::bakeStatic. Baked tiles are kept apart from
+            * the ones set with setSolid, so a rebake only clears its own and a tile that is both stays solid.
+            * @param x The tile column
+            * @param y The tile row
+            * @param solid Whether the tile blocks movement
+        */
+        void setBaked(int x, int y, bool solid = true);
+
+        /*
+            * Removes every baked tile, tiles set with setSolid stay
+        */
+        void clearBaked();
+
+        /*
+            * Gets the tile containing a world position
+            * @param position The world position
+            * @return The tile coordinates
+        */
+        auto worldToTile(const glm::vec2& position) const -> glm::ivec2;
+
+        /*
+            * Checks if any solid tile overlaps the given box
+            * @param min The minimum corner of the box
+            * @param max The maximum corner of the box
+            * @return True if a solid tile overlaps the box
+        */
+        auto overlaps(const glm::vec2& min, const glm::vec2& max) const -> bool;
+
+        /*
+            * Moves a box by delta, one axis at a time (x then y), stopping flush against the first solid tile on each axis.
+            * @param center The center of the box
+            * @param halfSize Half the size of the box
+            * @param delta The desired movement
+            * @return The allowed movement and which axes were blocked
+        */
+        auto sweep(const glm::vec2& center, const glm::vec2& halfSize, const glm::vec2& delta) const -> MoveResult;
+
+        auto getTileSize() const -> float { return m_tileSize; }
+
+        /*
+            * Removes every solid tile
+        */
+        void clear();
+
+    private:
+        // one bit per tile, bit x of rows[y] is tile (x, y) within the chunk
+        struct Chunk
+        {
+            std::array<uint32_t, ChunkSize> rows = {}; // solid either way, what sweeps read
+            std::array<uint32_t, ChunkSize> setRows = {};
+            std::array<uint32_t, ChunkSize> bakedRows = {};
+            int solidCount = 0;
+        };
+
+        float m_tileSize;
+        float m_inverseTileSize;
+        std::unordered_map<uint64_t, Chunk> m_chunks;
+
+        static inline auto chunkKey(int cx, int cy) -> uint64_t
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(cy)) << 32) | static_cast<uint32_t>(cx);
+        }
+
+        auto findChunk(int cx, int cy) const -> const Chunk*;
+
+        void writeTile(int x, int y, bool solid, bool baked);
+
+        /*
+            * Gets the solid bits of row y for columns [x0, x0 + 32), x0 must be chunk aligned.
+        */
+        auto rowBits(int x0, int y) const -> uint32_t;
+
+        /*
+            * Finds the first solid column in row y between from and to (inclusive), scanning from 'from' towards 'to'.
+            * @return True if one was found, the column is written to column
+        */
+        auto firstSolidInRow(int y, int from, int to, int& column) const -> bool;
+
+        auto anySolidInRow(int y, int x0, int x1) const -> bool;
+
+        auto sweepAxis(glm::vec2 min, glm::vec2 max, float delta, int axis, bool& hit) const -> float;
+};
@@ -0,0 +1,99 @@
+//
+//  GridTileBake.cpp
+//  SaplingEngine Tests
+//
+//  A body falling onto a level of static GridTransform colliders has to land on it through the tile layer.
+//
+
+#include "ECS/EntityManager.hpp"
+#include "Utility/PhysicsWorld.hpp"
+
+#include <iostream>
+#include <memory>
+
+static auto fail(const std::string& message) -> int
+{
+    std::cerr << message << "\n";
+    return 1;
+}
+
+int main()
+{
+    auto manager = std::make_shared<EntityManager>();
+    EntityManager& entityManager = *manager;
+    PhysicsWorld world;
+    world.setBakeGridTiles(true);
+
+    // a floor along row 5, each tile one cell centered on it
+    std::shared_ptr<Entity> firstTile;
+    std::shared_ptr<Entity> fourthTile;
+    for (int x = 0; x < 10; x++)
+    {
+        auto tile = entityManager.addEntity({"tile"});
+        tile->addComponent<Comp::GridTransform>(static_cast<int8_t>(x), static_cast<int8_t>(5));
+        tile->getComponent<Comp::Transform>().pivot = Sprout::Pivot::CENTER;
+        tile->addComponent<Comp::BBox>(static_cast<float>(Comp::GridTransform::CellSize), static_cast<float>(Comp::GridTransform::CellSize));
+        if (x == 0)
+        {
+            firstTile = tile;
+        }
+        if (x == 3)
+        {
+            fourthTile = tile;
+        }
+    }
+
+    auto body = entityManager.addEntity({"body"});
+    auto& transform = body->addComponent<Comp::Transform>(glm::vec2(100.0f, 100.0f), glm::vec2(0.0f, 300.0f));
+    transform.pivot = Sprout::Pivot::CENTER;
+    body->addComponent<Comp::BBox>(16.0f, 16.0f).isStatic = false;
+    entityManager.update();
+
+    // cells the game sets itself, one under a tile entity and one on its own
+    world.getTileLayer().setSolid(3, 5);
+    world.getTileLayer().setSolid(20, 2);
+
+    for (int i = 0; i < 60; i++)
+    {
+        world.step(entityManager, 1.0f / 60.0f);
+    }
+
+    const TileCollisionLayer& tiles = world.getTileLayer();
+    for (int x = 0; x < 10; x++)
+    {
+        if (!tiles.isSolid(x, 5) || tiles.isSolid(x, 4) || tiles.isSolid(x, 6))
+        {
+            return fail("row 5 should be the only solid row, column " + std::to_string(x) + " isn't");
+        }
+    }
+
+    // the floor's top edge is at 5 * 32, the body rests with its bottom on it
+    if (transform.position.y != 5.0f * Comp::GridTransform::CellSize - 8.0f || transform.velocity.y != 0.0f)
+    {
+        return fail("body at y " + std::to_string(transform.position.y) + " with velocity " + std::to_string(transform.velocity.y));
+    }
+
+    // the tiles never reach the broadphase, so landing on them makes no contacts
+    if (!world.getContacts().empty())
+    {
+        return fail(std::to_string(world.getContacts().size()) + " contacts, tiles went through the broadphase");
+    }
+
+    // removing a tile rebakes, its cell opens up again
+    firstTile->destroy();
+    fourthTile->destroy();
+    entityManager.update();
+    world.step(entityManager, 1.0f / 60.0f);
+    if (tiles.isSolid(0, 5) || !tiles.isSolid(1, 5))
+    {
+        return fail("destroyed tile still solid after the rebake");
+    }
+
+    // the rebake only clears what it baked, cells the game set stay solid
+    if (!tiles.isSolid(3, 5) || !tiles.isSolid(20, 2))
+    {
+        return fail("the rebake cleared a cell set with setSolid");
+    }
+
+    return 0;
+}
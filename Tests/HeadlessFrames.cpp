@@ -0,0 +1,62 @@
+//
+//  HeadlessFrames.cpp
+//  SaplingEngine Tests
+//
+//  Runs the renderer headless for the frames given with --frames N and checks every frame was drawn.
+//
+
+#include "Renderer/Sprout.hpp"
+#include "Core/JobSystem.hpp"
+
+#include <array>
+#include <iostream>
+#include <memory>
+
+int main(int argc, char** argv)
+{
+    JobSystem::initialize();
+
+    int updates = 0;
+    int frameLimit = 0;
+    {
+        Sprout::Window window(640, 360, "HeadlessFrames");
+        window.parseArguments(argc, argv);
+        frameLimit = window.getFrameLimit();
+
+        // a 2x2 texture with a transparent texel, so quads go through both passes
+        std::array<unsigned char, 16> pixels;
+        pixels.fill(255);
+        pixels[15] = 0;
+        auto texture = std::make_shared<Sprout::Texture>();
+        texture->loadFromMemory(pixels.data(), 2, 2);
+        texture->registerTexture();
+
+        window.SetUpdateFrameCallback([&](double)
+        {
+            updates++;
+            for (int i = 0; i < 1000; i++)
+            {
+                window.draw_sprite(texture, glm::vec2(i % 640, (i / 640) * 8), static_cast<float>(i % 4));
+            }
+        });
+        window.Run();
+
+        const Sprout::FrameStats& stats = window.getFrameStats();
+        if (stats.num_quads != 1000 || stats.dropped_draws != 0)
+        {
+            std::cerr << "last frame drew " << stats.num_quads << " quads, dropped " << stats.dropped_draws << "\n";
+            return 1;
+        }
+        texture->release();
+    }
+
+    // one update per frame, exactly as many as --frames asked for
+    if (frameLimit <= 0 || updates != frameLimit || Sprout::Window::getInstance() != nullptr)
+    {
+        std::cerr << "ran " << updates << " updates for a limit of " << frameLimit << " frames\n";
+        return 1;
+    }
+
+    JobSystem::cleanUp();
+    return 0;
+}
@@ -0,0 +1,219 @@
+//
+//  AtlasBaker.cpp
+//  Sapling Engine, Sprout Renderer
+//
+
+//  Build time tool that packs every png under the assets directory into
+//  padded atlas pages and writes them with their uv table as one file,
+//  which the engine maps at startup instead of decoding and packing.
+//
+//  usage: AtlasBaker <assets directory> <output file> [page size] [--no-trim]
+
+#include "Renderer/AtlasFormat.hpp"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb/stb_image.h"
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "stb/stb_rect_pack.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct Image
+{
+    std::string name; // relative to the assets directory, forward slashes
+    int width, height;
+    unsigned char* pixels;
+    Sprout::AtlasTrim trim;
+    int page = -1;
+    int x = 0, y = 0;
+};
+
+static auto load_images(const fs::path& assets, int page_size, bool trim) -> std::vector<Image>
+{
+    std::vector<Image> images;
+    for (const auto& file : fs::recursive_directory_iterator(assets))
+    {
+        if (!file.is_regular_file() || file.path().extension() != ".png")
+        {
+            continue;
+        }
+
+        Image image;
+        image.name = fs::relative(file.path(), assets).generic_string();
+
+        int channels;
+        image.pixels = stbi_load(file.path().string().c_str(), &image.width, &image.height, &channels, 4);
+        if (!image.pixels)
+        {
+            std::cerr << "skipping " << image.name << ": " << stbi_failure_reason() << std::endl;
+            continue;
+        }
+
+        image.trim = { 0, 0, image.width, image.height };
+        if (trim)
+        {
+            image.trim = Sprout::trim_transparent(image.pixels, image.width, image.height);
+        }
+
+        // big images are meant to be standalone textures, the runtime loads them itself
+        if (image.width + Sprout::ATLAS_PADDING * 2 > page_size || image.height + Sprout::ATLAS_PADDING * 2 > page_size)
+        {
+            std::cerr << "skipping " << image.name << ": larger than a page" << std::endl;
+            stbi_image_free(image.pixels);
+            continue;
+        }
+
+        images.push_back(image);
+    }
+    return images;
+}
+
+// packs all images at once so the packer can sort them by height, filling one page before opening the next
+static auto pack_images(std::vector<Image>& images, int page_size) -> int
+{
+    std::vector<stbrp_rect> rects;
+    for (size_t i = 0; i < images.size(); i++)
+    {
+        stbrp_rect rect = {};
+        rect.id = static_cast<int>(i);
+        rect.w = images[i].trim.width + Sprout::ATLAS_PADDING * 2;
+        rect.h = images[i].trim.height + Sprout::ATLAS_PADDING * 2;
+
+        // fully transparent images keep an entry but take no space
+        if (images[i].trim.width == 0)
+        {
+            images[i].page = 0;
+            continue;
+        }
+        rects.push_back(rect);
+    }
+
+    std::vector<stbrp_node> nodes(page_size);
+    int pages = 0;
+    while (!rects.empty())
+    {
+        stbrp_context context;
+        stbrp_init_target(&context, page_size, page_size, nodes.data(), page_size);
+        stbrp_setup_heuristic(&context, STBRP_HEURISTIC_Skyline_BF_sortHeight);
+        stbrp_pack_rects(&context, rects.data(), static_cast<int>(rects.size()));
+
+        for (const stbrp_rect& rect : rects)
+        {
+            if (rect.was_packed)
+            {
+                Image& image = images[rect.id];
+                image.page = pages;
+                image.x = rect.x + Sprout::ATLAS_PADDING;
+                image.y = rect.y + Sprout::ATLAS_PADDING;
+            }
+        }
+        rects.erase(std::remove_if(rects.begin(), rects.end(), [](const stbrp_rect& rect) { return rect.was_packed != 0; }), rects.end());
+        pages++;
+    }
+    return pages;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "usage: AtlasBaker <assets directory> <output file> [page size] [--no-trim]" << std::endl;
+        return 1;
+    }
+    const fs::path assets = argv[1];
+    const fs::path output = argv[2];
+    int page_size = 1024;
+    bool trim = true;
+    for (int i = 3; i < argc; i++)
+    {
+        if (std::string(argv[i]) == "--no-trim")
+        {
+            trim = false;
+        }
+        else
+        {
+            page_size = std::atoi(argv[i]);
+        }
+    }
+    if (page_size <= 0 || page_size > UINT16_MAX)
+    {
+        std::cerr << "invalid page size " << page_size << std::endl;
+        return 1;
+    }
+
+    std::vector<Image> images = load_images(assets, page_size, trim);
+    const int page_count = pack_images(images, page_size);
+
+    // entries are looked up by binary search on the mapped table
+    std::sort(images.begin(), images.end(), [](const Image& a, const Image& b) { return a.name < b.name; });
+
+    const size_t page_bytes = static_cast<size_t>(page_size) * page_size * 4;
+    std::vector<unsigned char> pixels(page_bytes * page_count, 0);
+    std::vector<Sprout::BakedAtlasEntry> entries;
+    std::string names;
+    for (const Image& image : images)
+    {
+        if (image.trim.width > 0)
+        {
+            const unsigned char* trimmed = image.pixels + (static_cast<size_t>(image.trim.y) * image.width + image.trim.x) * 4;
+            Sprout::blit_padded(pixels.data() + image.page * page_bytes, page_size, trimmed, image.width, image.trim.width, image.trim.height, image.x, image.y);
+        }
+
+        Sprout::BakedAtlasEntry entry = {};
+        entry.name_offset = static_cast<uint32_t>(names.size());
+        entry.name_length = static_cast<uint32_t>(image.name.size());
+        entry.page = static_cast<uint16_t>(image.page);
+        entry.x = static_cast<uint16_t>(image.x);
+        entry.y = static_cast<uint16_t>(image.y);
+        entry.width = static_cast<uint16_t>(image.trim.width);
+        entry.height = static_cast<uint16_t>(image.trim.height);
+        entry.source_width = static_cast<uint16_t>(image.width);
+        entry.source_height = static_cast<uint16_t>(image.height);
+        entry.trim_x = static_cast<uint16_t>(image.trim.x);
+        entry.trim_y = static_cast<uint16_t>(image.trim.y);
+        entries.push_back(entry);
+        names += image.name;
+
+        stbi_image_free(image.pixels);
+    }
+
+    Sprout::BakedAtlasHeader header = {};
+    header.magic = Sprout::BAKED_ATLAS_MAGIC;
+    header.version = Sprout::BAKED_ATLAS_VERSION;
+    header.page_size = static_cast<uint32_t>(page_size);
+    header.page_count = static_cast<uint32_t>(page_count);
+    header.entry_count = static_cast<uint32_t>(entries.size());
+    header.names_offset = static_cast<uint32_t>(sizeof(header) + entries.size() * sizeof(Sprout::BakedAtlasEntry));
+    header.pixels_offset = static_cast<uint32_t>((header.names_offset + names.size() + 15) & ~size_t(15));
+
+    std::ofstream out(output, std::ios::binary);
+    if (!out)
+    {
+        std::cerr << "can't write " << output << std::endl;
+        return 1;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(Sprout::BakedAtlasEntry));
+    out.write(names.data(), names.size());
+    const std::vector<char> alignment(header.pixels_offset - header.names_offset - names.size(), 0);
+    out.write(alignment.data(), alignment.size());
+    out.write(reinterpret_cast<const char*>(pixels.data()), pixels.size());
+    if (!out)
+    {
+        std::cerr << "failed writing " << output << std::endl;
+        return 1;
+    }
+
+    std::cout << "baked " << entries.size() << " textures into " << page_count << " pages of " << page_size << " to " << output << std::endl;
+    return 0;
+}